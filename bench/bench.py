@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""
+Benchmark of brainfuck: runs the corpus in each mode, and compares the results with a stored baseline.
+
+Each case is run in the modes of scripting (-s), executable file (compiled, linked, then run), interpreter (-i) and
+tiered (-T), with the time report in JSON for the phases parse, optimize, evaluate, generate, optimize-ir, lower,
+emit, link, jit and execute; the run of executable file is timed as its execute phase. The best time of the runs is
+kept for each phase and the total, with peak RSS, output size and digest of standard output; all modes of a case
+must print the same output.
+
+The results are written in JSON. With a baseline, a total or phase slower than the baseline by more than the
+tolerance (and the noise floor) is a regression, and so is an output differing from the baseline: the exit status
+is 1 if any. With --update-baseline the results are stored as the baseline instead.
+
+The corpus programs are in bench/corpus, the generated MB-scale sources and large input files are written in the
+work directory on the first run, see generate.py.
+"""
+import argparse
+import datetime
+import hashlib
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import time
+
+import generate
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_DIR = os.path.dirname(BENCH_DIR)
+
+MODES = {
+    'script': ['-s', '-n'],
+    'aot': [],
+    'interpret': ['-i'],
+    'tiered': ['-T'],
+}
+
+PHASES = ['parse', 'optimize', 'evaluate', 'generate', 'optimize-ir', 'lower', 'emit', 'link', 'jit', 'execute']
+
+
+class Case:
+    def __init__(self, name, source, input=None, modes=tuple(MODES)):
+        self.name = name
+        self.source = source
+        self.input = input
+        self.modes = modes
+
+
+CASES = [
+    Case('hello-world', 'test/hello-world.bf'),
+    Case('mandelbrot', 'bench/corpus/mandelbrot.bf'),
+    Case('hanoi', 'bench/corpus/hanoi.bf'),
+    Case('factor', 'bench/corpus/factor.bf', 'factor.txt'),
+    Case('fibonacci', 'bench/corpus/fibonacci.bf'),
+    Case('wc', 'test/wc.bf', 'text-4m.txt'),
+    Case('cat', 'test/cat.bf', 'text-16m.txt'),
+    Case('generated-256k', 'generated-256k.bf', 'factor.txt'),
+    Case('generated-16m', 'generated-16m.bf', 'factor.txt', ('interpret', 'tiered')),
+]
+
+
+def locate(work, path):
+    """Path of a file of corpus, or of the data generated in work directory."""
+    source = os.path.join(SOURCE_DIR, path)
+    return source if os.path.exists(source) else os.path.join(work, path)
+
+
+def parse_report(stderr):
+    """The last JSON line of time report in standard error."""
+    for line in reversed(stderr.decode(errors='replace').splitlines()):
+        if line.startswith('{"source":'):
+            return json.loads(line)
+    return None
+
+
+def run(command, work, input, output, timeout):
+    """Run command with input and output files, return the wall time in ms and standard error."""
+    with open(input, 'rb') if input else open(os.devnull, 'rb') as stdin, open(output, 'wb') as stdout:
+        begin = time.perf_counter()
+        process = subprocess.run(command, cwd=work, stdin=stdin, stdout=stdout, stderr=subprocess.PIPE,
+                                 timeout=timeout)
+        wall = (time.perf_counter() - begin) * 1e3
+    if process.returncode != 0:
+        message = process.stderr.decode(errors='replace').strip().splitlines()
+        raise RuntimeError('%s exited with %d%s' % (os.path.basename(command[0]), process.returncode,
+                                                    ': ' + message[-1] if message else ''))
+    return wall, process.stderr
+
+
+def digest(path):
+    hash = hashlib.sha1()
+    with open(path, 'rb') as file:
+        for block in iter(lambda: file.read(1 << 20), b''):
+            hash.update(block)
+    return hash.hexdigest(), os.path.getsize(path)
+
+
+def measure(options, case, mode):
+    """Run the case in mode, and return its result with the best times of runs."""
+    work = options.work
+    source = locate(work, case.source)
+    input = locate(work, case.input) if case.input else None
+    output = os.path.join(work, '%s.%s.out' % (case.name, mode))
+    # -o drops the extension of output file.
+    executable = '%s-%s' % (case.name, mode)
+    command = [options.brainfuck, '--time-report=json'] + MODES[mode]
+    if mode == 'aot':
+        command += ['-o', executable]
+    command.append(source)
+
+    samples = []
+    for _ in range(options.runs):
+        wall, stderr = run(command, work, input, output, options.timeout)
+        report = parse_report(stderr)
+        if report is None:
+            raise RuntimeError('no time report')
+        phases = {phase['phase']: phase for phase in report['phases']}
+        if mode == 'aot':
+            execute, _ = run([os.path.join(work, executable)], work, input, output, options.timeout)
+            phases['execute'] = {'wall_ms': execute, 'peak_rss_kb': 0}
+            wall += execute
+        samples.append((wall, phases, report))
+
+    result = {
+        'case': case.name,
+        'mode': mode,
+        'wall_ms': round(min(sample[0] for sample in samples), 3),
+        'samples_ms': [round(sample[0], 3) for sample in samples],
+        'phases': {},
+        'peak_rss_kb': max(phase['peak_rss_kb'] for sample in samples for phase in sample[1].values()),
+    }
+    for phase in PHASES:
+        times = [sample[1][phase]['wall_ms'] for sample in samples if phase in sample[1]]
+        if times:
+            result['phases'][phase] = round(min(times), 3)
+    report = samples[-1][2]
+    if report['ast']:
+        result['ast_nodes'] = report['ast'][-1]['nodes']
+    if report['ir']:
+        result['ir_instructions'] = report['ir'][-1]['instructions']
+    if 'object_bytes' in report:
+        result['object_bytes'] = report['object_bytes']
+    result['output_sha1'], result['output_bytes'] = digest(output)
+    os.remove(output)
+    if mode == 'aot':
+        os.remove(os.path.join(work, executable))
+    return result
+
+
+def compare(results, baseline, options):
+    """Print the results against the baseline, return the count of regressions."""
+    previous = {(result['case'], result['mode']): result for result in baseline['results']} if baseline else {}
+    regressions = 0
+    print('\n%-16s %-10s %12s %12s %9s  %s' % ('case', 'mode', 'wall (ms)', 'baseline', 'change', 'notes'))
+    for result in results:
+        notes = []
+        old = previous.get((result['case'], result['mode']))
+        if 'error' in result:
+            notes.append('FAILED: ' + result['error'])
+            regressions += 1
+        elif old is not None and 'error' not in old:
+            metrics = [('total', result['wall_ms'], old['wall_ms'])]
+            metrics += [(phase, result['phases'][phase], old['phases'][phase])
+                        for phase in PHASES if phase in result['phases'] and phase in old['phases']]
+            for name, new, base in metrics:
+                if new > base * (1 + options.tolerance) and new - base > options.noise:
+                    if base > 0:
+                        notes.append('%s slower %.1f%%' % (name, (new / base - 1) * 100))
+                    else:
+                        notes.append('%s slower %.1fms' % (name, new - base))
+            if result['output_sha1'] != old['output_sha1']:
+                notes.append('output differs from baseline')
+            regressions += len(notes)
+        if result.get('inconsistent'):
+            notes.append('output differs from other modes')
+            regressions += 1
+        base = '%.1f' % old['wall_ms'] if old is not None and 'wall_ms' in old else '-'
+        change = '%+.1f%%' % ((result['wall_ms'] / old['wall_ms'] - 1) * 100) \
+            if old is not None and 'wall_ms' in old and 'wall_ms' in result and old['wall_ms'] > 0 else '-'
+        wall = '%.1f' % result['wall_ms'] if 'wall_ms' in result else '-'
+        print('%-16s %-10s %12s %12s %9s  %s' % (result['case'], result['mode'], wall, base, change, '; '.join(notes)))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark of brainfuck with the corpus, see the module document.')
+    parser.add_argument('--brainfuck', required=True, help='the brainfuck executable file')
+    parser.add_argument('--work', default='bench-work', help='directory of generated data and outputs')
+    parser.add_argument('--results', help='results file, defaults to results.json in work directory')
+    parser.add_argument('--baseline', default=os.path.join(BENCH_DIR, 'baseline.json'), help='baseline file')
+    parser.add_argument('--update-baseline', action='store_true', help='store the results as baseline')
+    parser.add_argument('--runs', type=int, default=3, help='runs of each case and mode, the best is kept')
+    parser.add_argument('--cases', default='.', help='regular expression of case names')
+    parser.add_argument('--modes', default=','.join(MODES), help='comma separated modes: ' + ', '.join(MODES))
+    parser.add_argument('--tolerance', type=float, default=0.10, help='relative slowdown taken as noise')
+    parser.add_argument('--noise', type=float, default=5.0, help='absolute slowdown in ms taken as noise')
+    parser.add_argument('--timeout', type=float, default=600, help='timeout of each run in seconds')
+    options = parser.parse_args()
+    options.brainfuck = os.path.abspath(options.brainfuck)
+    options.work = os.path.abspath(options.work)
+    modes = options.modes.split(',')
+    for mode in modes:
+        if mode not in MODES:
+            parser.error('unknown mode ' + mode)
+
+    print('Generating data in %s' % options.work)
+    generate.write(options.work, generate.DATA)
+    version = subprocess.run([options.brainfuck, '-v'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    results = []
+    for case in CASES:
+        if not re.search(options.cases, case.name):
+            continue
+        outputs = set()
+        for mode in case.modes:
+            if mode not in modes:
+                continue
+            print('Running %s in %s mode' % (case.name, mode), flush=True)
+            try:
+                result = measure(options, case, mode)
+                outputs.add(result['output_sha1'])
+            except (RuntimeError, subprocess.TimeoutExpired) as error:
+                result = {'case': case.name, 'mode': mode, 'error': str(error)}
+            results.append(result)
+        if len(outputs) > 1:
+            for result in results:
+                if result['case'] == case.name and 'error' not in result:
+                    result['inconsistent'] = True
+
+    document = {
+        'version': version.stdout.decode(errors='replace').splitlines()[0] if version.stdout else '',
+        'date': datetime.datetime.now().isoformat(timespec='seconds'),
+        'host': {'system': platform.system(), 'machine': platform.machine(), 'processor': platform.processor(),
+                 'cpus': os.cpu_count()},
+        'runs': options.runs,
+        'results': results,
+    }
+    results_file = options.results or os.path.join(options.work, 'results.json')
+    with open(results_file, 'w') as file:
+        json.dump(document, file, indent=2)
+        file.write('\n')
+    print('\nResults written to %s' % results_file)
+
+    baseline = None
+    if options.update_baseline:
+        with open(options.baseline, 'w') as file:
+            json.dump(document, file, indent=2)
+            file.write('\n')
+        print('Baseline written to %s' % options.baseline)
+    elif os.path.exists(options.baseline):
+        with open(options.baseline) as file:
+            baseline = json.load(file)
+        print('Compared with baseline %s of %s, %s' % (options.baseline, baseline['version'], baseline['date']))
+    else:
+        print('No baseline %s, run with --update-baseline to store one' % options.baseline)
+    regressions = compare(results, baseline, options)
+    if regressions > 0:
+        print('\n%d regressions or failures' % regressions)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,853 @@
+Prime factors of the numbers below 2^24 read one per line by trial division; each trial is a binary long
+division with one bit per cell; the input ends at a line without digits
+Generated by the corpus generator of benchmark
+
+>>>>+[<<<,[->>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<--------------
+---------------------------------->++++++++++[->+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]
+<[[-]<->]<[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<->]<++++++++++[-
+]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<+<]>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<
+<<<<[-<.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>
+>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>
+>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>
++<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[
+->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<
+<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>
+>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]
+>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<
+<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[
+-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->
+>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]>>[->>>>>>>>>>>>>+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-]<<<<<<<<
+<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<
+<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>
+>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]
+<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>
+>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<
+<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<
+<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[
+->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<
+<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>
+>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<
+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>
+>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<
+<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<
+<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[-
+>>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<
+<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>
+>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<
+<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<
+<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>
++<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<
+<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<
+<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->
+>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<
+]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>
+>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<
+<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<
+<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>[->>+
+>+<<<]>>>[-<<<+>>>]<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<
+<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>
+>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<
+<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<
+<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<
++>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<
+<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>
+>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>
+>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>
+>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>
+]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>
+>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>
+>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>
+[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>
+>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+
+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-
+<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<
+<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<
++>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>
+]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<
+<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>
+>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<
+]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<
+<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]
+<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>
+>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<
+<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<
+[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>
+>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<
+-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[-
+>+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>
+>>[->>+>+<<<]>>>[-<<<+>>>]>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<
+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>
+>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>
+[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>
+>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<
+<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>
+>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<
+<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>
+>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<
+<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<
+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>
+>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<
+<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>
+>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>
+>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<
+<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>
+>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>
+]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]
+>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<
+-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<
+<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>
+>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+
+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<
+]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+
+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[-
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+
+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]
+<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>
+[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<
+<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<<[->>>>>>>>
+>>>>>>>>>+<<<<<<<<<<-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<],[->>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<---------
+--------------------------------------->++++++++++[->+<<[->>>>+<+<<<]>>>>[-<<<<+
+>>>>]<[[-]<->]<[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<->]<+++++++
++++[-]<<<<<<<<<<<<<<<<<<<<<<]<[-]>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<[[-]<->>++++++++[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<+++++++>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<++.>>>>>>>>>>
+>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<<<<<------->>>>>>>>>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<-->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>
+>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<
+<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>
+>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]
+>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>
+>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>
+[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<
+<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-
+>+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+
+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>
+>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<
+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>
+[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>
+>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]
+>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<
+<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]>>[->+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++
+++++++++++++++++++++++[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>
+>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<
+<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<
+<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[-
+>>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<
+<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>
+>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<
+<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+
+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<
+<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>
+>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]
+<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>
+>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<
+<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<
+<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[
+->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<
+<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>
+>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>[
+->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+
+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+
+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<
+<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>
+>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[
+-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<
+<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>
+>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>
+]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>
+>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->
+>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[->>+>>
+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++<<<
+[->>>>+<<<<]>>>>[-<<<<+>>>->]<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>
+]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<
+<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]
+<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]
+>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<
+]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<
+<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<
+[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>
+>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>
+>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<
+<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[-
+>+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>
+[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>
+>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<
+<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+
+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-
+<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>
+>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<
+<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<
+<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<
+<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>
+>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-
+<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[
+->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<
++>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>
++<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<
+<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->
+>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>
+>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<
+<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]
+>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>
+>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>
+>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>
+>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]
+>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>
+>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>
+>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[
+-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>
+>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]>>>>>>>>>[-<<+>>]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>
+>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>
+[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>
+>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[
+-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>
+>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>
+>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<
+<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>+<[->>>+<+<<]>>>[-<<<+>>>]
+<[[-]<->>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]
+>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<
+<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>
++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>
++>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[
+->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>
+>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<
++>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<
+<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>
+[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<
+<]>>>>>>[-<<<<<<+>>>>>>]>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]<[->+<<<[->>
+>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>
+>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<
+<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>
+>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>
+>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>-
+>]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[
+->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>
+[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>
+>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]
+>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->
+>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-
+<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>
+>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[
+-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>
+>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<
+<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>
+>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<
+<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+
+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+
+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>
+>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+
+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<
+<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>
+>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+
+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>
+]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<
+]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]
+<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<
+<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>>>>[-<<<<+>>>->]>[-<<+>>]<
+<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]>>>>>>>>>+<<<[->>>>+<<<<]>
+>>>[-<<<<+>>>->]>[-<<+>>]<<[->+<<<[->>>>>>>>>>>>>+<<<<<<<<<<-<<<]>>>[-<<<+>>>]<]
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]
+>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>
+>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>
+>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>+<[->>>+<+<<]>>>
+[-<<<+>>>]<[[-]<->>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>
++>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<
+<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>
+>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>
+>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[
+-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<
+<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->
+>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>
+>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[
+->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>]<[->+<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[[-]<-<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<]<[->>>>>>>>>>>>>>>[->+<<<<[->>>>>>>>
+>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>+>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>
+>>>>>>>+<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<]<[-]<]<[->>>>>>>>>>>>>>>>[->
+>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>
+>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>
+>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+
+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>
+[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]
+>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>
++<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-
+<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>
+>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<
+<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>[->>+>>+<<<<]>>>>[-<<
+<<+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>
+>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>
+>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[
+-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>
+>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>[-<+>]>>>>>>>
+>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<
++>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>
+>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>
+>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<+>]>>>>>>>>>[-<
++>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<
+<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>
+>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>
+>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>
+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]<->]<[->>>>>>>>>>>>[-<<<<<<<<<<+<+>
+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>>>>>>]<]<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>]<[-]>>>>>>>>>>>>>
+>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>
+>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-
+]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>
+>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[
+-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>
+>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>
+>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++++++++[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<++++>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<
+.>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<<<<<---->>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++[->[-]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>
+>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<
+<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>
++<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<
+<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<
+<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->
+>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<
+]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>
+>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<++>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>+<<<<<<]>>>>>>[->>>>>>>>>>>>>>+
+<+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[->>+<+<]>>[-<<+>
+>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>
+>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->
+>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<
+->]<[->>+<+<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<<<---------->>>>>>>>>>
+>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<++>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>>>>>>>>>+<+<<<<<<<<<<<<]
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+
+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<
+[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[
+-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<
++>>]<[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<<---------->>>>>>>>>>>>]<<<<<<<<<<<[->>>>
+>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<++>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>+<<<<<<<<]>>>>>>>>[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<
++>>>>>>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+
+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<
+[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[
+-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]<
+<<<<<<<<<<---------->>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<++>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>>>>>
+>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]
+<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>
+>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>
+>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->
+>+<+<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<<---------->>>>>>>>>>]<<<<<<<<<
+[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<++>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<
++>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<
+]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[
+->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<
+---------->>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<++>>>>>>>>]<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->>>>>>>>>+<+<<<<<<<<]>>>>
+>>>>>[-<<<<<<<<<+>>>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-
+]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+
+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]
+>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
++<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>]<[[-]<<<<<<<<---------->>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<
+++>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[->>>>>>>>+
+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[
+-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+
+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->
+]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<
+[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>]<[[-]<<<<<<<---------->>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>[-<<
+<<<<++>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>
+>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>
+[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>
++<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<-
+>]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]<[[-]<->]<[->>+<+<]>>[-<<+>>]
+<[[-]<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>]<[[-]<<<<<<---------->>>>>>]<<<<<<<<<<<<<<<<<<<[-]<]>>>>>>>>>
+>>>>>[->>>>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[[-]<<<<<<<<<<<<<<[-]+>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]<<<<<<++++++++++++++++++++++++++++++++++++++++++++
+++++.>>>>>>]<<<<<<[-]<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[[-]<<<<
+<<<<<<<<<<[-]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]<<<<<<<+++++++++++++++++++++
++++++++++++++++++++++++++++.>>>>>>>]<<<<<<<[-]<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[
+-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[
+-]<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>]<<<<<<<<[-]<
+[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[[-]<<<<<<<<<<<<<<[-
+]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<+++++++++++++++++++++++++++++++
++++++++++++++++++.>>>>>>>>>]<<<<<<<<<[-]<[->>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[
+-<<<<<<<<<<<+>>>>>>>>>>>]<[[-]<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+]<[[-]<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>]<<<<
+<<<<<<[-]<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<
+[[-]<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<+++++++++
++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>>]<<<<<<<<<<<[-]<[->>>>>>>>>>>
+>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<<<<
+[-]+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.>>>>>>>>>>>>]<<<<<<<<<<<<[-]<<[-]>+++++++++++++++++++++++
++++++++++++++++++++++++++.[-]<<<<<]<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>
+>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>
+>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]
+>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<++++++++++.---------->>>>>>>>>>
+>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<
+<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>
+[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>
+>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>
+>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>[-]>>>>>>>>>
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]
@@ -0,0 +1,12 @@
+The first 10000 Fibonacci numbers in decimal: the digits are frames of cells walked by loops to add
+the long numbers and print them
+Generated by the corpus generator of benchmark
+
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++[->+++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++[->>>>>>>>>>>[>[->>+<<]>[-<+>>+<]>[-<+[->>+>+<<<]>>>[-<<<+>>>]<---------->+<[
+++++++++++[-]>-<]>[-<<<---------->>>>>>>+<<<<]<<]>>>]>>>[-<+<<+>>>]<<<[>>>>>>]<<
+<<<<[>>++++++++++++++++++++++++++++++++++++++++++++++++.------------------------
+------------------------<<<<<<<<]>>>>++++++++++.----------<<<<<<<<<]<]
@@ -0,0 +1,157 @@
+Towers of hanoi of 21 disks printing all moves; the move m takes the disk of its lowest set bit from peg
+m minus lowbit mod 3 to m plus lowbit mod 3
+Generated by the corpus generator of benchmark
+
+>>>>>>>+<<<<<<+[>+[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>[-<<<<<+<+>>>>>>]<<<<<[->>>>>+<<<<<]<[[-]<->
+>>>>>>-<<<<<<]<[->>>>>>>+<<<<<<<<<<<<<<<<<<<<<<->+>>+>>>>>>>>>>>>]<]<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>]<[[-]>+>>>>>>>>[-<<<<<<+<+>>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[[-]<->>>>>>>>-<<
+<<<<<]<[->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<->+>>++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>]<[[-]>+>>>>>>>>>[-<<<<<<<+<+>>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[[-]<->>>>>>>>>
+-<<<<<<<<]<[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<->+>>+++>>>>>>>>>>>>]<]<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>]<[[-]>+>>>>>>>>>>[-<<<<<<<<+<+>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]<[[-
+]<->>>>>>>>>>-<<<<<<<<<]<[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<->+>>++++>+>>>>>>
+>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>[-<<<<<<<<<+<+>>>>>>>>>>]<<<<<<<<<[-
+>>>>>>>>>+<<<<<<<<<]<[[-]<->>>>>>>>>>>-<<<<<<<<<<]<[->>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<<<<<<<->+>>+++++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>[-<<<<<
+<<<<<+<+>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]<[[-]<->>>>>>>>>>>>-<<<<<<
+<<<<<]<[->>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>>++++++>+>>>>>>>>>>>]<]<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>[-<<<<<<<<<<<+<+>>>>>>>>>>>>]<<<<<<<<<<<[->>>>
+>>>>>>>+<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>-<<<<<<<<<<<<]<[->>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<->+>>+++++++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<+<+>>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<[[-
+]<->>>>>>>>>>>>>>-<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-
+>+>>++++++++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<+<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<[[-]<->>>>>>>>>
+>>>>>>-<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>>++++
++++++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+<+
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>
+>>>>>-<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>+>>
++>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+<+>>>
+>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>
+>>>>>>>-<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->
++>+>+>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<+<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[[-]<
+->>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<->+>+>++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>+>+++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>]<[[-]>+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>>>>>-<<
+<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+
+>+>++++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>+>+++++>>>>>>>>>>>>]<]<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]<[[-]<->>>
+>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<->+>+>++++++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>
+>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<->+>+>+++++++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>>>>
+>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<->+>+>++++++++>+>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<
++<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[[-]>+>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>
+>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>+>+++++++++>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[
+[-]>+>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<]<[[-]<->>>>>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<<<]<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->+>++>>+>>>>>>>>>>>]<]<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>]<[[-]>+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]<[[-]<->>>>>>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<
+<<<<<]<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-
+>+>++>+>>>>>>>>>>>>]<]<<<<<<<<<<<<<<[-<->]>>>>>>>[->>>>>>>+<<<<<<<]<[->+<]<[->+<
+]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+++++++++++[-<<<<<<<
+<<<<<<<<<+++++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>++++++++[-<<<<
+<<<<<<<<<<<<++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<++.+++++++.>>>>>>>>>>>>>>>>++++
+[-<<<<<<<<<<<<<<<<---->>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>+++++++
+++++[-<<<<<<<<<<<<<<<<------>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<---.>>>>>>>>>>>>>>>
+>+++++++++++[-<<<<<<<<<<<<<<<<++++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<++.+++++.++
+++++++++.--------.>>>>>>>>>>>>>>>>+++++++++++++++[-<<<<<<<<<<<<<<<<----->>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<---->>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<
++>>>>>>>>>>>>>]<[[-]<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++
+.>>>>>>>>>>>>]<<<<<<<<<<<<[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[
+-]>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<.>>>
+>>>>>>>>>>>>>++++++++++[-<<<<<<<<<<<<<<<<+++++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<.++++++++++++.---.--.>>>>>>>>>>>>>>>>+++++++++++[-<<<<<<<<<<<<<<<<------->>>>>>
+>>>>>>>>>>]<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<---->>>>>>
+>>>>>>>>>>]<<<<<<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<
+[[-]>+<<<<<<<<<<<[->>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>
+>>>>>>>>>>]<[[-]<->>+++++++++++[-<<<<<<<<<<<<<<<<<<<++++++>>>>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<---->>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<--.>>>>>>>>>>>>>>>>>>>++++++++++++[-<<<<<<<<<<<<<<<
+<<<<+++++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<.-----.>>>>>>>>>>>>>>>>>>>++++
++++++++++[-<<<<<<<<<<<<<<<<<<<------>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<-.>>>
+>>>>>>>>>>>>>>>>+++++++[-<<<<<<<<<<<<<<<<<<<+++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<<<.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<------->>>>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<<<<<<<-.---------->>>>>>>>>>>>>>>>>>]<[->+++++++++++[-<<<<<<<<<
+<<<<<<<<<++++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>+++++++[
+-<<<<<<<<<<<<<<<<<<----->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>>>
+++++++++++++[-<<<<<<<<<<<<<<<<<<+++++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.---
+--.>>>>>>>>>>>>>>>>>>+++++++++++++[-<<<<<<<<<<<<<<<<<<------>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<++++>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<++.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<-----
+-->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.---------->>>>>>>>>>>>>>>>>]<]<<<<<<<<[-
+>>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]>+<<<<<<<<<<<[->>>>>>>>
+>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[[-]<->>+++++++
+++++[-<<<<<<<<<<<<<<<<<<<++++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<+.>>>>>>>>
+>>>>>>>>>>>+++++++[-<<<<<<<<<<<<<<<<<<<----->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<.>>>>>>>>>>>>>>>>>>>++++++++++++[-<<<<<<<<<<<<<<<<<<<+++++++>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<<.-----.>>>>>>>>>>>>>>>>>>>+++++++++++++[-<<<<<<<<<<<<<<<<<
+<<------>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>>++++++++[-<<
+<<<<<<<<<<<<<<<<<++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>
+>+++++++++++[-<<<<<<<<<<<<<<<<<<<----->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<.--
+-------->>>>>>>>>>>>>>>>>>]<[->++++++++[-<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<---->>>>
+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>++++++++++++[-<<<<<<<<<<<<<
+<<<<<+++++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.-----.>>>>>>>>>>>>>>>>>>++++++
++++++++[-<<<<<<<<<<<<<<<<<<------>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<-.>>>>>>>>
+>>>>>>>>>>+++++++[-<<<<<<<<<<<<<<<<<<+++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.
+>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<------->>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<-.---------->>>>>>>>>>>>>>>>>]<]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-
+<<<<<<<<+>>>>>>>>]<[[-]>+<<<<<<<<<<<[->>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[[-]<->>++++++++[-<<<<<<<<<<<<<<<<<<<++++++++>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<
+<<<<<---->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>>+++++++++++
++[-<<<<<<<<<<<<<<<<<<<+++++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<.-----.>>>>>
+>>>>>>>>>>>>>>+++++++++++++[-<<<<<<<<<<<<<<<<<<<------>>>>>>>>>>>>>>>>>>>]<<<<<<
+<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<++++>>>>>>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<<<<<<++.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<---
+---->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<.---------->>>>>>>>>>>>>>>>>>]<[->+++
+++++++++[-<<<<<<<<<<<<<<<<<<++++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.>>>>>>>>
+>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<---->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<-
+-.>>>>>>>>>>>>>>>>>>++++++++++++[-<<<<<<<<<<<<<<<<<<+++++++>>>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<.-----.>>>>>>>>>>>>>>>>>>+++++++++++++[-<<<<<<<<<<<<<<<<<<------
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<-.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<
+<<<<<++++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>+++++++++++[-<
+<<<<<<<<<<<<<<<<<----->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<.---------->>>>>>>>>>
+>>>>>>>]<]<<<<<<<<<<[-]<<<]<<]
@@ -0,0 +1,1215 @@
+Mandelbrot set of 80x40 characters with at most 90 iterations in fixed point numbers of 18
+bits with 10 bits of fraction; one bit per cell and squared by shift and add
+Generated by the corpus generator of benchmark
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>
+>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>
+]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+
+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>
+>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-
+<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>
+>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>
+>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<
+<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>
+>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-
+<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>
+>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>
+>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<
+<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>
+>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->
++<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>
+>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>
+>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]
+<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>
+>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<
+<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>
+>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[
+->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>
+>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<+++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<+[->>>>>>>
+>>>>>>>>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>]>>[->>+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>>>>
+>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>
+>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>
++<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<
+<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<
+<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<
+<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<
+<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<+>>>>>>>>>>>>>]>>>[->>+>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>+<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>>>+<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>>>+<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>>>+
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>>>
++<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>>
+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>>
+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>>
+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>>
+>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>>
+>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>>
+>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>>
+>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>>
+>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+>
+>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>+
+>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>>
++>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>>
+>+>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>[->>
+>>+>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>
+>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>
++<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<
+<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<
++>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>
+>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<
+<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>
+>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>
+>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<
+<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>
+>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>
+>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<
+<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]
+<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]
+>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<
+<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>
+>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<
+<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]
+>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[-
+>>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>
+]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>
+>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<]>>>>>>>>>>
+>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+++[->>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>
+>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>
+]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>
+>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>
+>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<
++>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-
+<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>
+>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>
+>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>
+[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>
+>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>>>>+<<<<<<<<<<<<]
+>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>
+>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-
+<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<
+<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>
+>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>
+>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>
+>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>
+>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>
+>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<
+<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<
+<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>
+>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>
+>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<
+<<<<<<<<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<
+<+>>>>>>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>
+>>>>>>>]>>>>[->>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>
+]<<<<<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>
+>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>
+>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-
+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>
+>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<
+<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[-
+>>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>
+>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>
+>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<
+<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]
+>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>+<<<<[->>>>-<<<
+<]>>>>[-<<<<+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<<<<[->>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<
+<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>
+>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+
+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->
++<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>
+>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<
+<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<
+<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>
+>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>
+>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+
+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>
+>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<
+]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<[->>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]<]>>>>>>>>>>>>>>>>>>[
+-<<+>>]<<[->+<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<]>>>>[-<<<<+>>>>]
+<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>
+>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>
+>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>
+>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>
+>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>
+>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]
+>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>
+>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>
+>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<
++>>>>]>>>>>>>>>>>>[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++[->>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<+<+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<]<[[-]>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[->+<<[->>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<
+]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+
+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-
+<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<
+[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[-
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<-<<]>>[-<<+>>]<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<
+]>>[-<<+>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>
+>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>
+>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>
+[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>
+>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]
+>>>>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>
+]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>
+>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>
+>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<
++>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>
+>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>
+>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>
+>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+
+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<
+<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<
+<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>
+>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<
+<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>
+>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+
+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>
+>>]>>>>>>>[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[->+<<
+[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>
+>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>
+>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-
+<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>
+>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>
+>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<
+<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+
+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<
+[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>
+>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>
+>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-
+<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>
+>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>
+>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<
+<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+
+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<
+[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>[->>>>>>>+>+<<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>
+>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-
+<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->
++<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<
+<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>
+>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>
+>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-
+<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+
+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>>>>+>>[-<<
++>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>>>>>>>>>>>
+>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<<+>>]<]>>>
+>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<]>>[-<
+<+>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[
+-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>
+>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<
+<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>
+>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>
++<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<
+<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>
+>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<
+<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>
+>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<
+<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>
+>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+
+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<
+]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>
+>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<
+<<<+>>>>>>>>>]>>>>>>>[-<<<<<+>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>->]<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>
+>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>
+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<
+<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<
+]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+
+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<
+<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>
+>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>
++<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]
+>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>
+>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<
+<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>
+>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>
+>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+
+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<
+<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>
+>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<
+<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>
+>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>
+>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[
+->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]
+>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<
+<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>
+>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[
+-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>
++>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->
++<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<
++>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>
+>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>
+>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<
+<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-
+<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>
+>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>
+>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>
+>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<
+<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<
+<<<<<+>>>>>>>]>>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>
+>>>>>>>>[-<<<<<<+>>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<++<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->
+]<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<
+<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>
+>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>
+>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>
+]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>-
+>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<
+<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<
+<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>
+>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>
+>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<
+<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<
+<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>
+>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>
+>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]
+<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->
+]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-
+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<
+<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<
+<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>
+>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<
++>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>
+>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<
+[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<
+<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>
+>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<
+]>>>>>>>>>>>>>>>>+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>->]
+>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<
+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>>>[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++<<<<<<<[->>>>>>>>+<<<<<<<<]>>
+>>>>>>[-<<<<<<<<+>>>>>>>->]<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>
+>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[
+->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<
+]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>
++<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<
++>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+
+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>
+>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<
+<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>
+>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>
+->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<
+<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>
+>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>
+]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<
+<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<
+<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[-
+>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<
+<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>
+>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<
+[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<
+<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>
+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<
++>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>
+>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<
+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>
+>>>>>>>>]<]>>>>>>>>>>>>>>>>+<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>->]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>>>>>>
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>+>+<<<<<]>>>>>[-<
+<<<<+>>>>>]<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-
+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+
+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>
+]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>
+>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<
+<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>
+>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>
+>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<
+<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[
+->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>
+>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>
+]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-
+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+
+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>
+]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>
+>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<
+<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>
+>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>
+>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<+>>]<<[->+
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<<<<<<<<]>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>[->>>>+>+<<<<<]>>>>>[-<<<
+<<+>>>>>]>[-<<+>>]<<[->+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<-<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<]>>>>>>>>>>>>>
+>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<-[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[[-]<<<<<<<<+>>>>>>>>]<
+<]>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[
+-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+++++++++++[-<<<<<<<<<+++++++++++>>>>>>>>>]+<<<<<<<[-<<->>>>>>>>>[-
+]<<<<<<<]>>>>>>>[-<<<<<<<<<+++++>>>>>>>>>]<<<<<<<<<.[-]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<
++>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>
+>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<
+<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>+>
+>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->
++<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>
+>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>
+>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]
+<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>
+>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<
+<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-<
+<+>>]<<[->+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<<]>>>>>>[-<<<<
+<<+>>>>>>]<]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++.---------->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>
+>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-
+<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>
+>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>+>>[-<<+>>]<<[->+<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>
+>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<
+<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>
+>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<
+<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>
+>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<
+<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>
+>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<
+<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>>>>>>[-<<+>>]<<[->+<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-<<<<<]>>>>>[-<<<<<+>>>>>]<]>>>>>>>>>>>>>
+>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
@@ -0,0 +1,835 @@
+#!/usr/bin/env python3
+"""
+Generator of the benchmark corpus.
+
+The heavy programs are written with a small macro assembler: every macro works on cells at fixed positions, and
+leaves the data pointer where it knows it is, so the loops of generated code are balanced by construction. The
+numbers of mandelbrot, hanoi and factor are binary, one bit per cell, with the bits of all numbers interleaved and
+the scratch cells of each bit beside it; the long numbers of fibonacci are decimal digits walked by loops.
+
+Usage:
+    generate.py programs <directory>    write mandelbrot.bf, hanoi.bf, factor.bf and fibonacci.bf
+    generate.py data <directory>        write the generated MB-scale sources and large input files
+
+Both outputs are deterministic, the programs are committed in bench/corpus, the data are written at bench time.
+"""
+import os
+import random
+import sys
+from contextlib import contextmanager
+
+
+class Program:
+    """
+    Brainfuck code under construction, with the position of data pointer and a pool of scratch cells.
+    """
+
+    def __init__(self, scratches):
+        self.code = []
+        self.position = 0
+        self.scratches = list(reversed(scratches))
+
+    def text(self, comment):
+        """The code after a comment, which must not contain any command."""
+        assert not set(comment) & set('+-<>[].,'), comment
+        return comment.strip() + '\n\n' + wrap(''.join(self.code)) + '\n'
+
+    def go(self, cell):
+        distance = cell - self.position
+        self.code.append('>' * distance if distance > 0 else '<' * -distance)
+        self.position = cell
+
+    def emit(self, commands):
+        self.code.append(commands)
+
+    def add(self, cell, value):
+        if value != 0:
+            self.go(cell)
+            self.emit('+' * value if value > 0 else '-' * -value)
+
+    def change(self, cell, value):
+        """Add a value of any size, large values with a multiplication loop."""
+        if abs(value) <= 16:
+            self.add(cell, value)
+            return
+        sign = 1 if value > 0 else -1
+        factor = min(range(2, 17), key=lambda f: f + abs(value) // f + abs(value) % f)
+        with self.scratch() as counter:
+            self.add(counter, abs(value) // factor)
+            with self.loop(counter):
+                self.add(counter, -1)
+                self.add(cell, sign * factor)
+        self.add(cell, sign * (abs(value) % factor))
+
+    def clear(self, cell):
+        self.go(cell)
+        self.emit('[-]')
+
+    def put(self, cell):
+        self.go(cell)
+        self.emit('.')
+
+    def get(self, cell):
+        self.go(cell)
+        self.emit(',')
+
+    @contextmanager
+    def scratch(self):
+        """A zero cell, which must be zero again when released."""
+        cell = self.scratches.pop()
+        yield cell
+        self.scratches.append(cell)
+
+    @contextmanager
+    def loop(self, cell):
+        self.go(cell)
+        self.emit('[')
+        yield
+        self.go(cell)
+        self.emit(']')
+
+    @contextmanager
+    def walk(self, cell, step):
+        """Loop moving the data pointer by step each iteration, the positions are relative to the current frame."""
+        self.go(cell)
+        self.emit('[')
+        yield
+        self.go(cell + step)
+        self.emit(']')
+        self.position = cell
+
+    def move(self, source, *targets):
+        with self.loop(source):
+            self.add(source, -1)
+            for target in targets:
+                self.add(target, 1)
+
+    def copy(self, source, *targets):
+        with self.scratch() as saved:
+            self.move(source, saved, *targets)
+            self.move(saved, source)
+
+    @contextmanager
+    def when(self, cell):
+        """Run the body once if cell is not zero."""
+        with self.scratch() as flag:
+            self.copy(cell, flag)
+            with self.loop(flag):
+                self.clear(flag)
+                yield
+
+    @contextmanager
+    def unless(self, cell):
+        """Run the body once if cell is zero."""
+        with self.scratch() as flag:
+            self.add(flag, 1)
+            with self.when(cell):
+                self.add(flag, -1)
+            with self.loop(flag):
+                self.add(flag, -1)
+                yield
+
+    def branch(self, cell, then, otherwise):
+        with self.scratch() as flag:
+            self.add(flag, 1)
+            with self.when(cell):
+                self.add(flag, -1)
+                then()
+            with self.loop(flag):
+                self.add(flag, -1)
+                otherwise()
+
+    def write(self, text, cell):
+        """Print text with a zero cell."""
+        value = 0
+        for byte in text.encode():
+            self.change(cell, byte - value)
+            self.put(cell)
+            value = byte
+        self.change(cell, -value)
+
+
+def wrap(code, width=80):
+    return '\n'.join(code[index:index + width] for index in range(0, len(code), width))
+
+
+class Lanes:
+    """
+    Layout of binary numbers: bit i of every field sits in lane i, so the bits added or moved together are close.
+    Fields t, u and c of each lane are scratch cells of the arithmetic, c holds the carry into the lane.
+    """
+
+    def __init__(self, base, fields, count):
+        self.fields = list(fields) + ['t', 'u', 'c']
+        self.base = base
+        self.count = count
+        self.end = base + len(self.fields) * count
+
+    def cell(self, field, lane):
+        return self.base + lane * len(self.fields) + self.fields.index(field)
+
+    def word(self, field, width, offset=0):
+        return [self.cell(field, lane) for lane in range(offset, offset + width)]
+
+    def lane(self, cell):
+        return (cell - self.base) // len(self.fields)
+
+    def beside(self, cell, field='u'):
+        """The scratch cell in the lane of cell."""
+        return self.cell(field, self.lane(cell))
+
+
+# Binary arithmetic, one bit per cell, least significant bit first.
+
+def toggle(p, bit, carry, flag):
+    """Flip the bit, and count the carry when it was set."""
+    p.add(flag, 1)
+    with p.loop(bit):
+        p.add(bit, -1)
+        p.add(carry, 1)
+        p.add(flag, -1)
+    with p.loop(flag):
+        p.add(flag, -1)
+        p.add(bit, 1)
+
+
+def add_word(p, lanes, a, b=None, constant=0, carry=0, invert=False, keep_carry=False):
+    """
+    a += b + constant + carry, modulo 2 to the width of a; b is complemented with invert, and may be narrower.
+    Return the cell of carry out if kept.
+    """
+    for index in range(len(a)):
+        t = lanes.beside(a[index], 't')
+        u = lanes.beside(a[index], 'u')
+        if index == 0 and carry:
+            p.add(t, 1)
+        if b is not None and index < len(b):
+            if invert:
+                p.add(t, 1)
+                p.move(b[index], u)
+                with p.loop(u):
+                    p.add(u, -1)
+                    p.add(b[index], 1)
+                    p.add(t, -1)
+            else:
+                p.move(b[index], t, u)
+                p.move(u, b[index])
+        elif invert:
+            p.add(t, 1)
+        p.add(t, constant >> index & 1)
+        if index > 0:
+            p.move(lanes.beside(a[index], 'c'), t)
+        with p.loop(t):
+            p.add(t, -1)
+            toggle(p, a[index], lanes.beside(a[index], 'c') + len(lanes.fields), u)
+    carry_out = lanes.beside(a[-1], 'c') + len(lanes.fields)
+    if not keep_carry:
+        p.clear(carry_out)
+    return carry_out
+
+
+def increment(p, lanes, a):
+    add_word(p, lanes, a, carry=1)
+
+
+def negate(p, lanes, a):
+    for index, bit in enumerate(a):
+        flag = lanes.beside(bit)
+        p.add(flag, 1)
+        with p.loop(bit):
+            p.add(bit, -1)
+            p.add(flag, -1)
+        p.move(flag, bit)
+    increment(p, lanes, a)
+
+
+def copy_word(p, lanes, source, target):
+    """Copy bit by bit, with the scratch cell u beside each source bit."""
+    for s, t in zip(source, target):
+        saved = lanes.beside(s)
+        p.move(s, t, saved)
+        p.move(saved, s)
+
+
+def move_word(p, source, target):
+    for s, t in zip(source, target):
+        p.move(s, t)
+
+
+def clear_word(p, a):
+    for bit in a:
+        p.clear(bit)
+
+
+def shift_up(p, cells):
+    """cells[i] = cells[i - 1], the top cell must be zero or is discarded."""
+    p.clear(cells[-1])
+    for index in reversed(range(1, len(cells))):
+        p.move(cells[index - 1], cells[index])
+
+
+def shift_down(p, cells):
+    p.clear(cells[0])
+    for index in range(1, len(cells)):
+        p.move(cells[index], cells[index - 1])
+
+
+def count_bits(p, lanes, a, target):
+    """target += count of set bits."""
+    for bit in a:
+        saved = lanes.beside(bit)
+        p.move(bit, target, saved)
+        p.move(saved, bit)
+
+
+# Programs
+
+def mandelbrot(width=80, height=40, iterations=90, fraction=10, bits=18):
+    """
+    ASCII Mandelbrot set in signed fixed point numbers of 18 bits with 10 bits of fraction.
+    Each squaring multiplies the magnitude by shift and add, bit by bit, so it runs billions of commands.
+    """
+    lanes = Lanes(17, ['x', 'y', 'p', 'q', 's', 'xx', 'yy', 'ss', 'cx', 'cy', 'a', 'b', 'r'], 2 * bits)
+    p = Program(range(9, 17))
+    out, alive, count, rows, columns, sign, counter, more, turns = range(9)
+    word = lambda field, width=bits: lanes.word(field, width)
+    scale = 1 << fraction
+    modulo = 1 << bits
+
+    def square(source, target):
+        """
+        Product of magnitude, adding to the high half and shifting right for each bit. The magnitudes are below 16,
+        but the square of x + y of an escaping point, which is never used.
+        """
+        half = fraction + 4
+        a = word('a')
+        b = word('b')
+        r = word('r', 2 * half + 1)
+        copy_word(p, lanes, source, a)
+        p.copy(source[-1], sign)
+        with p.loop(sign):
+            p.add(sign, -1)
+            negate(p, lanes, a)
+        copy_word(p, lanes, a, b)
+        p.add(counter, half)
+        with p.loop(counter):
+            p.add(counter, -1)
+            with p.when(b[0]):
+                add_word(p, lanes, r[half:], a[:half])
+            shift_down(p, r)
+            shift_down(p, b)
+        clear_word(p, a)
+        clear_word(p, b)
+        move_word(p, r[fraction:fraction + bits], target)
+        clear_word(p, r)
+
+    x, y, xx, yy, ss, cx, cy = (word(field) for field in ['x', 'y', 'xx', 'yy', 'ss', 'cx', 'cy'])
+    queue = [word(field) for field in ['p', 'q', 's']]
+    add_word(p, lanes, cy, constant=round(-1.125 * scale) % modulo)
+    p.add(rows, height)
+    with p.loop(rows):
+        p.add(rows, -1)
+        add_word(p, lanes, cx, constant=round(-2.0 * scale) % modulo)
+        p.add(columns, width)
+        with p.loop(columns):
+            p.add(columns, -1)
+            p.add(count, iterations)
+            p.add(alive, 1)
+            with p.loop(alive):
+                p.add(alive, -1)
+                # x^2, y^2 and (x + y)^2 - x^2 - y^2 = 2xy, squared in turn at one site for compact code
+                copy_word(p, lanes, x, queue[0])
+                copy_word(p, lanes, y, queue[1])
+                copy_word(p, lanes, x, queue[2])
+                add_word(p, lanes, queue[2], y)
+                p.add(turns, 3)
+                with p.loop(turns):
+                    p.add(turns, -1)
+                    move_word(p, yy, xx)
+                    move_word(p, ss, yy)
+                    square(queue[0], ss)
+                    clear_word(p, queue[0])
+                    move_word(p, queue[1], queue[0])
+                    move_word(p, queue[2], queue[1])
+                # escape if xx + yy > 4
+                d = word('r')
+                copy_word(p, lanes, xx, d)
+                add_word(p, lanes, d, yy)
+                add_word(p, lanes, d, constant=(-4 * scale - 1) % modulo)
+                p.move(d[-1], more)
+                clear_word(p, d)
+                with p.loop(more):
+                    p.add(more, -1)
+                    clear_word(p, x)
+                    clear_word(p, y)
+                    copy_word(p, lanes, xx, x)
+                    add_word(p, lanes, x, yy, carry=1, invert=True)
+                    add_word(p, lanes, x, cx)
+                    copy_word(p, lanes, ss, y)
+                    add_word(p, lanes, y, xx, carry=1, invert=True)
+                    add_word(p, lanes, y, yy, carry=1, invert=True)
+                    add_word(p, lanes, y, cy)
+                    p.add(count, -1)
+                    with p.when(count):
+                        p.add(alive, 1)
+                clear_word(p, xx)
+                clear_word(p, yy)
+                clear_word(p, ss)
+            clear_word(p, x)
+            clear_word(p, y)
+            # escaped after k iterations prints chr(31 + k), the points in the set print '~'
+            p.change(out, 31 + iterations)
+            with p.scratch() as inside:
+                p.add(inside, 1)
+                with p.loop(count):
+                    p.add(count, -1)
+                    p.add(out, -1)
+                    p.clear(inside)
+                with p.loop(inside):
+                    p.add(inside, -1)
+                    p.change(out, ord('~') - 31 - iterations)
+            p.put(out)
+            p.clear(out)
+            add_word(p, lanes, cx, constant=round(2.5 * scale / width) % modulo)
+        clear_word(p, cx)
+        p.write('\n', out)
+        add_word(p, lanes, cy, constant=round(2.25 * scale / height) % modulo)
+    clear_word(p, cy)
+    return p.text(f"""
+Mandelbrot set of {width}x{height} characters with at most {iterations} iterations in fixed point numbers of {bits}
+bits with {fraction} bits of fraction; one bit per cell and squared by shift and add
+Generated by the corpus generator of benchmark
+""")
+
+
+def hanoi(disks=21):
+    """
+    Towers of hanoi, printing all 2^n - 1 moves: the move m takes the disk of its lowest set bit, from peg
+    (m - lowbit) mod 3 to (m + lowbit) mod 3, with m mod 3 kept in three cells.
+    """
+    p = Program(range(16, 24))
+    out, alive, carry, moved, tens, ones, odd, r0, r1, r2 = range(10)
+    m = list(range(24, 24 + disks))
+
+    def stop(index):
+        def then():
+            p.add(m[index], 1)
+            p.add(carry, -1)
+            p.add(moved, 1)
+            p.add(tens, (index + 1) // 10)
+            p.add(ones, (index + 1) % 10)
+            p.add(odd, index % 2)
+        return then
+
+    p.add(r0, 1)
+    p.add(alive, 1)
+    with p.loop(alive):
+        p.add(carry, 1)
+        for index in range(disks):
+            with p.when(carry):
+                p.branch(m[index], lambda index=index: p.add(m[index], -1), stop(index))
+        with p.loop(carry):
+            p.add(carry, -1)
+            p.add(alive, -1)
+        with p.scratch() as saved:
+            p.move(r2, saved)
+            p.move(r1, r2)
+            p.move(r0, r1)
+            p.move(saved, r0)
+        with p.loop(moved):
+            p.add(moved, -1)
+            p.write('Move disk ', out)
+            with p.when(tens):
+                p.add(tens, ord('0'))
+                p.put(tens)
+            p.clear(tens)
+            p.add(ones, ord('0'))
+            p.put(ones)
+            p.clear(ones)
+            p.write(' from ', out)
+            for residue, cell in enumerate([r0, r1, r2]):
+                with p.when(cell):
+                    pegs = lambda low: 'ABC'[(residue - low) % 3] + ' to ' + 'ABC'[(residue + low) % 3] + '\n'
+                    p.branch(odd, lambda: p.write(pegs(2), out), lambda: p.write(pegs(1), out))
+            p.clear(odd)
+    return p.text(f"""
+Towers of hanoi of {disks} disks printing all moves; the move m takes the disk of its lowest set bit from peg
+m minus lowbit mod 3 to m plus lowbit mod 3
+Generated by the corpus generator of benchmark
+""")
+
+
+def factor(bits=24, digits=8):
+    """
+    Prime factors of numbers below 2^24 read one per line, by trial division with binary long division.
+    The input ends at a line without digits.
+    """
+    lanes = Lanes(40, ['n', 'q', 'r', 'd', 'v', 'w'], bits + 1)
+    p = Program(range(24, 40))
+    (out, ch, digit, had, alive, going, counter, carry, emit, two, small, last,
+     started, *decimals) = range(13 + digits)
+    assert len(decimals) == digits and decimals[-1] < 24
+    n, q, r, d, v, w = (lanes.word(field, bits) for field in ['n', 'q', 'r', 'd', 'v', 'w'])
+
+    def is_digit():
+        with p.scratch() as value, p.scratch() as steps:
+            p.copy(ch, value)
+            p.add(value, -ord('0'))
+            p.add(steps, 10)
+            with p.loop(steps):
+                p.add(steps, -1)
+                with p.unless(value):
+                    p.add(digit, 1)
+                p.add(value, -1)
+            p.add(value, 10)
+            p.clear(value)
+
+    def divide():
+        """q, r = divmod(n, d), the high bits of remainder shift out of q while the quotient bits shift in."""
+        copy_word(p, lanes, n, q)
+        p.add(counter, bits)
+        with p.loop(counter):
+            p.add(counter, -1)
+            shift_up(p, q + r)
+            copy_word(p, lanes, r, v)
+            p.move(add_word(p, lanes, v, d, carry=1, invert=True, keep_carry=True), carry)
+            with p.when(carry):
+                clear_word(p, r)
+                move_word(p, v, r)
+            clear_word(p, v)
+            p.move(carry, q[0])
+
+    def print_decimal():
+        """Print w in decimal, doubling the decimal digits bit by bit."""
+        p.add(counter, bits)
+        with p.loop(counter):
+            p.add(counter, -1)
+            shift_up(p, w + [carry])
+            for cell in decimals:
+                with p.scratch() as doubled:
+                    p.move(cell, doubled)
+                    with p.loop(doubled):
+                        p.add(doubled, -1)
+                        p.add(cell, 2)
+                p.move(carry, cell)
+                with p.scratch() as excess:
+                    p.copy(cell, excess)
+                    for _ in range(9):
+                        with p.when(excess):
+                            p.add(excess, -1)
+                    with p.when(excess):
+                        p.add(carry, 1)
+                    p.clear(excess)
+                with p.when(carry):
+                    p.add(cell, -10)
+            p.clear(carry)
+        for cell in reversed(decimals[1:]):
+            with p.when(cell):
+                p.clear(started)
+                p.add(started, 1)
+            with p.when(started):
+                p.add(cell, ord('0'))
+                p.put(cell)
+            p.clear(cell)
+        p.clear(started)
+        p.add(decimals[0], ord('0'))
+        p.put(decimals[0])
+        p.clear(decimals[0])
+
+    def divisible():
+        copy_word(p, lanes, d, w)
+        p.add(emit, 1)
+        clear_word(p, n)
+        move_word(p, q, n)
+        count_bits(p, lanes, n[1:], small)
+        with p.unless(small):
+            with p.when(n[0]):
+                p.clear(going)
+        p.clear(small)
+
+    def indivisible():
+        copy_word(p, lanes, q, v)
+        p.move(add_word(p, lanes, v, d, carry=1, invert=True, keep_carry=True), carry)
+        clear_word(p, v)
+        with p.scratch() as below:
+            p.add(below, 1)
+            with p.loop(carry):
+                p.add(carry, -1)
+                p.add(below, -1)
+            p.branch(below, prime, advance)
+            p.clear(below)
+
+    def prime():
+        copy_word(p, lanes, n, w)
+        p.add(emit, 1)
+        p.clear(going)
+
+    def advance():
+        def first():
+            p.clear(two)
+            p.add(d[0], 1)
+        p.branch(two, first, lambda: add_word(p, lanes, d, constant=2))
+
+    def factorize():
+        p.write(':', out)
+        count_bits(p, lanes, n[1:], going)
+        with p.when(going):
+            p.clear(going)
+            p.add(going, 1)
+        p.add(d[1], 1)
+        p.add(two, 1)
+        with p.loop(going):
+            divide()
+            count_bits(p, lanes, r, last)
+            with p.scratch() as remainder:
+                p.move(last, remainder)
+                p.branch(remainder, indivisible, divisible)
+                p.clear(remainder)
+            clear_word(p, q)
+            clear_word(p, r)
+            with p.loop(emit):
+                p.add(emit, -1)
+                p.write(' ', out)
+                print_decimal()
+        clear_word(p, d)
+        p.clear(two)
+        p.write('\n', out)
+
+    p.add(alive, 1)
+    with p.loop(alive):
+        p.get(ch)
+        is_digit()
+        p.copy(digit, had)
+        with p.loop(digit):
+            p.add(digit, -1)
+            p.put(ch)
+            p.add(ch, -ord('0'))
+            # n = (n << 3) + (n << 1) + digit
+            copy_word(p, lanes, n[:-1], v[1:])
+            for _ in range(3):
+                shift_up(p, n)
+            add_word(p, lanes, n, v)
+            clear_word(p, v)
+            with p.loop(ch):
+                p.add(ch, -1)
+                increment(p, lanes, n)
+            p.get(ch)
+            is_digit()
+        p.clear(ch)
+        p.branch(had, factorize, lambda: p.clear(alive))
+        p.clear(had)
+        clear_word(p, n)
+    return p.text(f"""
+Prime factors of the numbers below 2^{bits} read one per line by trial division; each trial is a binary long
+division with one bit per cell; the input ends at a line without digits
+Generated by the corpus generator of benchmark
+""")
+
+
+def fibonacci(rounds=40, count=250):
+    """
+    Fibonacci numbers in decimal: the digits are frames of cells, walked by loops to add and print.
+    """
+    p = Program(range(2, 6))
+    outer, inner = 0, 1
+    size = 6
+    base = 6 + size  # the first digit frame, after an empty frame as sentinel
+    mark, a, b, c, u, v = range(size)
+
+    def at(frame, field):
+        return frame * size + field
+
+    p.go(base)
+    p.add(base + mark, 1)
+    p.add(base + b, 1)
+    p.add(outer, rounds)
+    with p.loop(outer):
+        p.add(outer, -1)
+        p.add(inner, count)
+        with p.loop(inner):
+            p.add(inner, -1)
+            # add a to b digit by digit, walking to the top: a = b, b = (a + b) mod 10, carry into the next frame
+            p.go(base)
+            p.position = 0
+            with p.walk(at(0, mark), size):
+                p.move(at(0, a), at(0, c))
+                p.move(at(0, b), at(0, a), at(0, c))
+                with p.loop(at(0, c)):
+                    p.add(at(0, c), -1)
+                    p.add(at(0, b), 1)
+                    p.move(at(0, b), at(0, u), at(0, v))
+                    p.move(at(0, v), at(0, b))
+                    p.add(at(0, u), -10)
+                    p.add(at(0, v), 1)
+                    with p.loop(at(0, u)):
+                        p.add(at(0, u), 10)
+                        p.clear(at(0, u))
+                        p.add(at(0, v), -1)
+                    with p.loop(at(0, v)):
+                        p.add(at(0, v), -1)
+                        p.add(at(0, b), -10)
+                        p.add(at(1, c), 1)
+            # a carry out of the top digit opens a new frame
+            with p.loop(at(0, c)):
+                p.add(at(0, c), -1)
+                p.add(at(0, b), 1)
+                p.add(at(0, mark), 1)
+            with p.walk(at(0, mark), size):
+                pass
+            # print the digits from the top, walking back to the sentinel
+            p.go(at(-1, mark))
+            p.position = 0
+            with p.walk(at(0, mark), -size):
+                p.add(at(0, b), ord('0'))
+                p.put(at(0, b))
+                p.add(at(0, b), -ord('0'))
+            p.add(at(0, u), 10)
+            p.put(at(0, u))
+            p.add(at(0, u), -10)
+            p.go(at(0, mark))
+            p.position = base - size
+        p.go(inner)
+    return p.text(f"""
+The first {rounds * count} Fibonacci numbers in decimal: the digits are frames of cells walked by loops to add
+the long numbers and print them
+Generated by the corpus generator of benchmark
+""")
+
+
+# Data
+
+def generated_source(size, seed):
+    """
+    Machine-generated source of about size bytes: straight runs, idioms and counted loops nested a few levels,
+    with comment lines. It reads one byte first, so nothing is evaluated at compile time.
+    """
+    generator = random.Random(seed)
+    window = 64
+    chunks = [',[->+>+<<]>>[-<<+>>]<<\n']
+    length = len(chunks[0])
+
+    def run(position, avoid, depth):
+        parts = []
+        for _ in range(generator.randint(2, 8)):
+            target = generator.choice([cell for cell in range(window) if cell not in avoid])
+            parts.append(('>' if target > position else '<') * abs(target - position))
+            position = target
+            kind = generator.random()
+            if kind < 0.45:
+                parts.append(generator.choice('+-') * generator.randint(1, 12))
+            elif kind < 0.55:
+                parts.append('[-]')
+            elif kind < 0.75:
+                other = generator.choice([cell for cell in range(window) if cell not in avoid and cell != target])
+                step = other - target
+                arrow, back = ('>', '<') if step > 0 else ('<', '>')
+                parts.append('[-' + arrow * abs(step) + '+' * generator.randint(1, 3) + back * abs(step) + ']')
+            elif kind < 0.8:
+                parts.append('.')
+            elif depth < 3:
+                parts.append('[-]' + '+' * generator.randint(1, 4) + '[-')
+                inner, position_inside = run(target, avoid | {target}, depth + 1)
+                parts.append(inner)
+                back = target - position_inside
+                parts.append(('>' if back > 0 else '<') * abs(back) + ']')
+        return ''.join(parts), position
+
+    position = 0
+    while length < size:
+        code, end = run(position, set(), 0)
+        code += '<' * end
+        if generator.random() < 0.1:
+            code += '\nComment line of generated source number %d\n' % generator.randint(0, 1 << 20)
+        chunks.append(code)
+        length += len(code)
+    return wrap(''.join(chunks), 100) + '\n'
+
+
+def text_input(size, seed):
+    """Text of words and lines, like prose."""
+    generator = random.Random(seed)
+    words = ['brainfuck', 'compiler', 'loop', 'cell', 'tape', 'pointer', 'the', 'a', 'of', 'and', 'to', 'in',
+             'is', 'it', 'optimization', 'interpreter', 'byte', 'code', 'program', 'input', 'output', 'LLVM']
+    lines = []
+    length = 0
+    while length < size:
+        line = ' '.join(generator.choice(words) for _ in range(generator.randint(0, 14)))
+        lines.append(line)
+        length += len(line) + 1
+    return ('\n'.join(lines) + '\n')[:size]
+
+
+def factor_input(seed):
+    """Numbers below 2^24: primes near the top, products of two primes, and smooth numbers."""
+    generator = random.Random(seed)
+
+    def is_prime(number):
+        if number < 2:
+            return False
+        divisor = 2
+        while divisor * divisor <= number:
+            if number % divisor == 0:
+                return False
+            divisor += 1
+        return True
+
+    numbers = [0, 1, 2, 1 << 23, 720720, 16777213]
+    while len(numbers) < 120:
+        kind = len(numbers) % 3
+        if kind == 0:
+            number = generator.randrange(1 << 23, 1 << 24)
+            while not is_prime(number):
+                number -= 1
+        elif kind == 1:
+            first = generator.randrange(1000, 4000) | 1
+            while not is_prime(first):
+                first += 2
+            second = generator.randrange(1000, (1 << 24) // first) | 1
+            while not is_prime(second) or first * second >= 1 << 24:
+                second -= 2
+            number = first * second
+        else:
+            number = 1
+            while True:
+                prime = generator.choice([2, 3, 5, 7, 11, 13, 17, 19, 23])
+                if number * prime >= 1 << 24:
+                    break
+                number *= prime
+        numbers.append(number)
+    return ''.join('%d\n' % number for number in numbers)
+
+
+PROGRAMS = {
+    'mandelbrot.bf': mandelbrot,
+    'hanoi.bf': hanoi,
+    'factor.bf': factor,
+    'fibonacci.bf': fibonacci,
+}
+
+DATA = {
+    'generated-256k.bf': lambda: generated_source(256 << 10, 256),
+    'generated-16m.bf': lambda: generated_source(16 << 20, 16),
+    'text-4m.txt': lambda: text_input(4 << 20, 4),
+    'text-16m.txt': lambda: text_input(16 << 20, 16),
+    'factor.txt': lambda: factor_input(24),
+}
+
+
+def write(directory, files):
+    os.makedirs(directory, exist_ok=True)
+    for name, make in files.items():
+        path = os.path.join(directory, name)
+        if files is DATA and os.path.exists(path):
+            continue
+        with open(path, 'w') as file:
+            file.write(make())
+
+
+def main():
+    if len(sys.argv) != 3 or sys.argv[1] not in ('programs', 'data'):
+        sys.exit(__doc__.strip())
+    write(sys.argv[2], PROGRAMS if sys.argv[1] == 'programs' else DATA)
+
+
+if __name__ == '__main__':
+    main()
@@ -1,108 +1,513 @@
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ast.h"
 
-/* Global AST Root */
-Ast AstRoot = NULL;
+/**
+ * Chunk of constant bytes, the bytes are never moved once allocated.
+ */
+typedef struct _Chunk {
+  struct _Chunk* next;
+  int size;
+  int used;
+  unsigned char bytes[];
+} *Chunk;
+
+/* Ast */
 
 /**
- * Constructor for Instruction.
+ * Constructor for AST: empty program.
  */
-Instruction NewInstruction(InstructionSymbol symbol, int parameter) {
-  Instruction instruction = (Instruction)calloc(sizeof(struct _Instruction), 1);
-  instruction->symbol = symbol;
-  instruction->parameter = parameter;
-  return instruction;
+Ast NewAst(void) {
+  Ast ast = (Ast)calloc(sizeof(struct _Ast), 1);
+  ast->capacity = AST_INITIAL_CAPACITY;
+  ast->nodes = (Node)malloc(sizeof(struct _Node) * ast->capacity);
+  return ast;
 }
 
 /**
- * Destructor for Instruction.
+ * Destructor for AST: free the nodes and the chunks of constant bytes.
  */
-void DisposeInstruction(Instruction instruction) {
-  if (instruction != NULL) {
-    free(instruction);
+void DisposeAst(Ast ast) {
+  if (ast != NULL) {
+    while (ast->chunks != NULL) {
+      Chunk chunk = ast->chunks;
+      ast->chunks = chunk->next;
+      free(chunk);
+    }
+    free(ast->nodes);
+    free(ast);
   }
 }
 
-/* Ast */
-
 /**
- * Constructor for Instruction Node.
+ * Append a zeroed node to the end of program, the returned node is valid until the next append.
  */
-Ast NewInstructionNode(NodeType type, Instruction instruction, Ast previous) {
-  Ast node = (Ast)calloc(sizeof(struct _Ast), 1);
+Node AppendNode(Ast ast, NodeType type) {
+  if (ast->count == ast->capacity) {
+    ast->capacity *= 2;
+    ast->nodes = (Node)realloc(ast->nodes, sizeof(struct _Node) * ast->capacity);
+  }
+  Node node = &ast->nodes[ast->count++];
+  memset(node, 0, sizeof(struct _Node));
   node->type = type;
-  node->instruction = instruction;
-  node->previous = previous;
   return node;
 }
 
 /**
- * Constructor for Block Node.
+ * Append an instruction node to the end of program.
  */
-Ast NewBlockNode(NodeType type, Ast block, Ast previous) {
-  Ast node = (Ast)calloc(sizeof(struct _Ast), 1);
-  node->type = type;
-  node->block = block;
-  node->previous = previous;
+Node AppendInstruction(Ast ast, InstructionSymbol symbol, int parameter) {
+  Node node = AppendNode(ast, InstructionNode);
+  node->instruction.symbol = symbol;
+  node->instruction.parameter = parameter;
   return node;
 }
 
 /**
- * Destructor for AST: free whole tree.
+ * Append an instruction node, or add the parameter to the last node if it's the same instruction:
+ * runs of updates and moves take one node while parsing.
  */
-void DisposeAst(Ast ast) {
-  while (ast != NULL) {
-    if (ast->type == InstructionNode) {
-      DisposeInstruction(ast->instruction);
+Node MergeInstruction(Ast ast, InstructionSymbol symbol, int parameter) {
+  if (ast->count > 0) {
+    Node last = &ast->nodes[ast->count - 1];
+    if (last->type == InstructionNode && last->instruction.symbol == symbol) {
+      last->instruction.parameter += parameter;
+      return last;
+    }
+  }
+  return AppendInstruction(ast, symbol, parameter);
+}
+
+/**
+ * Allocate constant bytes living as long as the AST.
+ */
+unsigned char* AllocateBytes(Ast ast, int length) {
+  Chunk chunk = ast->chunks;
+  if (chunk == NULL || chunk->size - chunk->used < length) {
+    int size = length > AST_CHUNK_SIZE ? length : AST_CHUNK_SIZE;
+    chunk = (Chunk)malloc(sizeof(struct _Chunk) + size);
+    chunk->size = size;
+    chunk->used = 0;
+    // a large allocation takes its own chunk, the current chunk is kept for the small ones.
+    if (ast->chunks != NULL && size > AST_CHUNK_SIZE) {
+      chunk->next = ast->chunks->next;
+      ast->chunks->next = chunk;
     } else {
-      DisposeAst(ast->block);
+      chunk->next = ast->chunks;
+      ast->chunks = chunk;
+    }
+  }
+  unsigned char* bytes = chunk->bytes + chunk->used;
+  chunk->used += length;
+  return bytes;
+}
+
+/**
+ * Match the block and block end nodes after the nodes are moved by a pass.
+ */
+static void LinkBlocks(Ast ast) {
+  int* stack = (int*)malloc(sizeof(int) * (ast->count / 2 + 1));
+  int depth = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == BlockNode) {
+      stack[depth++] = index;
+    } else if (node->type == BlockEndNode) {
+      int begin = stack[--depth];
+      ast->nodes[begin].jump = index;
+      node->jump = begin;
     }
-    Ast previous = ast->previous;
-    free(ast);
-    ast = previous;
   }
+  free(stack);
 }
 
+/* Optimizations: each pass moves the kept nodes forward in place, and never writes a node not read yet. */
+
 /**
  * The Mergeable attribute of instruction symbol.
  */
-static bool MergeableInstructions[] = { true, true, false, false };
+static bool MergeableInstructions[] = { true, true, false, false, false, false, false, false };
 
 /**
  * Return if the nodes are same (same node type and same instruction symbol)
  * and mergeable (instruction type node only).
  */
-static int AreSameAndMergeable(Ast this, Ast that) {
+static int AreSameAndMergeable(Node this, Node that) {
   return (this->type == that->type)
       && (this->type == InstructionNode)
-      && (this->instruction->symbol == that->instruction->symbol)
-      && (MergeableInstructions[this->instruction->symbol]);
+      && (this->instruction.symbol == that->instruction.symbol)
+      && (this->instruction.offset == that->instruction.offset)
+      && (MergeableInstructions[this->instruction.symbol]);
+}
+
+/**
+ * Return if the node is an instruction node with given symbol.
+ */
+static bool IsInstruction(Node node, InstructionSymbol symbol) {
+  return node != NULL
+      && node->type == InstructionNode
+      && node->instruction.symbol == symbol;
 }
 
 /**
- * Merge the serial and mergeable instruction.
+ * Put an instruction node at the index, return the index after it.
+ */
+static int PutInstruction(Ast ast, int index, InstructionSymbol symbol, int parameter) {
+  Node node = &ast->nodes[index];
+  memset(node, 0, sizeof(struct _Node));
+  node->type = InstructionNode;
+  node->instruction.symbol = symbol;
+  node->instruction.parameter = parameter;
+  return index + 1;
+}
+
+/**
+ * Merge the serial and mergeable instruction,
+ * and fold the update instruction into the set instruction before it.
  */
 static void ReduceSerialMergeableInstructions(Ast ast) {
-  while (ast->previous != NULL) {
-    if (AreSameAndMergeable(ast, ast->previous)) {
-      Ast previous = ast->previous;
-      ast->instruction->parameter += previous->instruction->parameter;
-      ast->previous = previous->previous;
-      free(previous);
+  int count = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    Node previous = count > 0 ? &ast->nodes[count - 1] : NULL;
+    if (previous != NULL && AreSameAndMergeable(previous, node)) {
+      previous->instruction.parameter += node->instruction.parameter;
+    } else if (IsInstruction(node, UpdateInstruction)
+        && IsInstruction(previous, SetInstruction)
+        && node->instruction.offset == previous->instruction.offset) {
+      previous->instruction.parameter += node->instruction.parameter;
     } else {
-      if (ast->type == BlockNode) {
-        ReduceSerialMergeableInstructions(ast->block);
+      ast->nodes[count++] = *node;
+    }
+  }
+  ast->count = count;
+  LinkBlocks(ast);
+}
+
+/**
+ * Balanced loop with single decrement (or increment) on the loop cell,
+ * e.g. `[-]`, `[->+<]` and `[->+++>++<<]`.
+ * Collect the changes of cells into offsets and deltas, return the count of changed cells,
+ * or -1 if the loop is not the idiom.
+ */
+static int AnalyzeLinearLoop(Ast ast, int loop, int* offsets, int* deltas) {
+  int count = 0;
+  int position = 0;
+  for (int index = ast->nodes[loop].jump - 1; index > loop; index--) {
+    Node node = &ast->nodes[index];
+    if (node->type != InstructionNode) {
+      return -1;
+    }
+    Instruction instruction = &node->instruction;
+    if (instruction->symbol == MoveInstruction) {
+      position -= instruction->parameter;
+    } else if (instruction->symbol == UpdateInstruction) {
+      int index = 0;
+      while (index < count && offsets[index] != position) {
+        index++;
+      }
+      if (index == count) {
+        offsets[count] = position;
+        deltas[count] = 0;
+        count++;
       }
-      ast = ast->previous;
+      deltas[index] += instruction->parameter;
+    } else {
+      return -1;
+    }
+  }
+  // walking backward from the end of loop: the end position is offset 0.
+  for (int index = 0; index < count; index++) {
+    offsets[index] -= position;
+  }
+
+  if (position != 0) {
+    return -1;
+  }
+  for (int index = 0; index < count; index++) {
+    if (offsets[index] == 0) {
+      int delta = deltas[index] & 0xFF;
+      return delta == 0x01 || delta == 0xFF ? count : -1;
     }
   }
+  return -1;
 }
 
 /**
- * Invoke AST optimizations.
+ * Rewrite the linear loop to multiply instructions on each changed cell,
+ * and clear the loop cell at last. Return the index after the rewritten nodes.
  */
-void OptimizeAst(Ast ast) {
+static int RewriteLinearLoop(Ast ast, int index, int count, int* offsets, int* deltas) {
+  int step = 0;
+  for (int change = 0; change < count; change++) {
+    if (offsets[change] == 0) {
+      step = (deltas[change] & 0xFF) == 0xFF ? -1 : 1;
+    }
+  }
+
+  for (int change = 0; change < count; change++) {
+    if (offsets[change] != 0 && (deltas[change] & 0xFF) != 0) {
+      index = PutInstruction(ast, index, MultiplyInstruction, -step * deltas[change]);
+      ast->nodes[index - 1].instruction.target = offsets[change];
+    }
+  }
+  return PutInstruction(ast, index, SetInstruction, 0);
+}
+
+/**
+ * Pure scan loop only moves the data pointer with non-zero stride, e.g. `[>]`, `[<<]`.
+ */
+static bool IsScanLoop(Ast ast, int loop) {
+  Node body = &ast->nodes[loop + 1];
+  return ast->nodes[loop].jump == loop + 2
+      && IsInstruction(body, MoveInstruction)
+      && body->instruction.parameter != 0;
+}
+
+/**
+ * Recognize clear, copy, multiply and scan loops, and rewrite them into straight-line code.
+ * The rewritten nodes are never more than the nodes of loop.
+ */
+static void RecognizeIdioms(Ast ast) {
+  int* offsets = (int*)calloc(sizeof(int), ast->count + 1);
+  int* deltas = (int*)calloc(sizeof(int), ast->count + 1);
+  int count = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == BlockNode) {
+      int end = node->jump;
+      if (IsScanLoop(ast, index)) {
+        count = PutInstruction(ast, count, ScanInstruction, ast->nodes[index + 1].instruction.parameter);
+        index = end;
+        continue;
+      }
+      int changes = AnalyzeLinearLoop(ast, index, offsets, deltas);
+      if (changes >= 0) {
+        count = RewriteLinearLoop(ast, count, changes, offsets, deltas);
+        index = end;
+        continue;
+      }
+    }
+    ast->nodes[count++] = *node;
+  }
+  ast->count = count;
+  LinkBlocks(ast);
+  free(offsets);
+  free(deltas);
+}
+
+/**
+ * Put a move instruction node at the index if the step is not zero, return the index after it.
+ */
+static int PutMoveNode(Ast ast, int index, int step) {
+  if (step == 0) {
+    return index;
+  }
+  return PutInstruction(ast, index, MoveInstruction, step);
+}
+
+/**
+ * Sink the pointer movements to the boundaries of blocks:
+ * the instructions address the cells with offset instead,
+ * and only one move instruction is left before each loop, scan and the end of block.
+ * A move is put only after another one is removed, so the nodes never grow.
+ */
+static void SinkPointerMovements(Ast ast) {
+  int count = 0;
+  int position = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    if (IsInstruction(node, MoveInstruction)) {
+      position += node->instruction.parameter;
+      continue;
+    }
+
+    if (node->type != InstructionNode || IsInstruction(node, ScanInstruction)) {
+      count = PutMoveNode(ast, count, position);
+      position = 0;
+    } else {
+      node->instruction.offset = position;
+    }
+    ast->nodes[count++] = *node;
+  }
+  ast->count = PutMoveNode(ast, count, position);
+  LinkBlocks(ast);
+}
+
+/**
+ * Known values of cells relative to the data pointer.
+ */
+typedef struct _KnownValues {
+  /* cells not in the table are zero. */
+  bool zeroed;
+  int count;
+  struct {
+    int offset;
+    int value;
+    bool known;
+  } cells[KNOWN_VALUES_CAPACITY];
+} *KnownValues;
+
+/**
+ * Get the value of the cell, return if the value is known.
+ */
+static bool GetKnownValue(KnownValues values, int offset, int* value) {
+  for (int index = 0; index < values->count; index++) {
+    if (values->cells[index].offset == offset) {
+      *value = values->cells[index].value;
+      return values->cells[index].known;
+    }
+  }
+  *value = 0;
+  return values->zeroed;
+}
+
+/**
+ * Forget all values, only the cell of data pointer is known as zero.
+ */
+static void ForgetKnownValues(KnownValues values) {
+  values->zeroed = false;
+  values->count = 1;
+  values->cells[0].offset = 0;
+  values->cells[0].value = 0;
+  values->cells[0].known = true;
+}
+
+/**
+ * Set the value of the cell, or mark it unknown.
+ */
+static void SetKnownValue(KnownValues values, int offset, int value, bool known) {
+  int index = 0;
+  while (index < values->count && values->cells[index].offset != offset) {
+    index++;
+  }
+  if (index == KNOWN_VALUES_CAPACITY) {
+    // table is full: forget everything except this cell.
+    values->zeroed = false;
+    values->count = 0;
+    index = 0;
+  }
+  if (index == values->count) {
+    values->count++;
+  }
+  values->cells[index].offset = offset;
+  values->cells[index].value = value & 0xFF;
+  values->cells[index].known = known;
+}
+
+/**
+ * Track the effect of the instruction on known values.
+ */
+static void UpdateKnownValues(KnownValues values, Instruction instruction) {
+  int offset = instruction->offset;
+  int value = 0;
+  bool known = GetKnownValue(values, offset, &value);
+  switch (instruction->symbol) {
+  case UpdateInstruction:
+    SetKnownValue(values, offset, value + instruction->parameter, known);
+    break;
+  case SetInstruction:
+    SetKnownValue(values, offset, instruction->parameter, true);
+    break;
+  case InputInstruction:
+    SetKnownValue(values, offset, 0, false);
+    break;
+  case MultiplyInstruction:
+    if (!known || value != 0) {
+      int target = 0;
+      bool targetKnown = GetKnownValue(values, offset + instruction->target, &target);
+      SetKnownValue(values, offset + instruction->target, target + value * instruction->parameter, known && targetKnown);
+    }
+    break;
+  case MoveInstruction:
+    for (int index = 0; index < values->count; index++) {
+      values->cells[index].offset -= instruction->parameter;
+    }
+    break;
+  case ScanInstruction:
+    ForgetKnownValues(values);
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * Put a write instruction node of the pending bytes at the index, return the index after it.
+ */
+static int PutWriteNode(Ast ast, int index, unsigned char* bytes, int* length) {
+  if (*length == 0) {
+    return index;
+  }
+  unsigned char* copy = AllocateBytes(ast, *length);
+  memcpy(copy, bytes, *length);
+  index = PutInstruction(ast, index, WriteInstruction, *length);
+  ast->nodes[index - 1].instruction.bytes = copy;
+  *length = 0;
+  return index;
+}
+
+/**
+ * Replace outputs of known values with writes of constant bytes,
+ * serial constant outputs are coalesced into one write until the next input, unknown output or loop.
+ * Loops never entered (the loop cell is known as zero) are removed.
+ */
+static void CoalesceConstantOutputs(Ast ast) {
+  // the data segment is initialized to zero.
+  struct _KnownValues values = { .zeroed = true, .count = 0 };
+  unsigned char* bytes = (unsigned char*)malloc(ast->count + 1);
+  int length = 0;
+  int count = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    int value = 0;
+    if (node->type == BlockNode) {
+      if (GetKnownValue(&values, 0, &value) && value == 0) {
+        index = node->jump;
+        continue;
+      }
+      count = PutWriteNode(ast, count, bytes, &length);
+      // nothing is known in the loop body.
+      values.zeroed = false;
+      values.count = 0;
+    } else if (node->type == BlockEndNode) {
+      count = PutWriteNode(ast, count, bytes, &length);
+      ForgetKnownValues(&values);
+    } else if (IsInstruction(node, OutputInstruction)
+        && GetKnownValue(&values, node->instruction.offset, &value)) {
+      bytes[length++] = value;
+      continue;
+    } else {
+      if (IsInstruction(node, InputInstruction)
+          || IsInstruction(node, OutputInstruction)
+          || IsInstruction(node, ScanInstruction)) {
+        count = PutWriteNode(ast, count, bytes, &length);
+      }
+      UpdateKnownValues(&values, &node->instruction);
+    }
+    ast->nodes[count++] = *node;
+  }
+  ast->count = PutWriteNode(ast, count, bytes, &length);
+  LinkBlocks(ast);
+  free(bytes);
+}
+
+/**
+ * Invoke AST optimizations in place, return the optimized AST.
+ */
+Ast OptimizeAst(Ast ast, Report report) {
+  ReportAstNodes(report, "parsed", ast->count);
+  ReduceSerialMergeableInstructions(ast);
+  ReportAstNodes(report, "merged", ast->count);
+  RecognizeIdioms(ast);
+  ReportAstNodes(report, "idioms", ast->count);
+  SinkPointerMovements(ast);
+  ReportAstNodes(report, "sunk", ast->count);
   ReduceSerialMergeableInstructions(ast);
+  ReportAstNodes(report, "merged", ast->count);
+  CoalesceConstantOutputs(ast);
+  ReportAstNodes(report, "coalesced", ast->count);
+  return ast;
 }
@@ -1,41 +1,87 @@
 #ifndef __AST_H_
 #define __AST_H_
 
+#include "report.h"
+
+/* Max count of cells tracked by known values analysis. */
+#define KNOWN_VALUES_CAPACITY 256
+
+/* Initial capacity of the node array of AST. */
+#define AST_INITIAL_CAPACITY 1024
+
+/* Size of the chunks allocating constant bytes of AST. */
+#define AST_CHUNK_SIZE (64 * 1024)
+
 typedef enum {
   UpdateInstruction = 0,
   MoveInstruction,
   InputInstruction,
-  OutputInstruction
+  OutputInstruction,
+  SetInstruction,
+  MultiplyInstruction,
+  ScanInstruction,
+  WriteInstruction
 } InstructionSymbol;
 
 typedef struct _Instruction {
   InstructionSymbol symbol;
   int parameter;
+  /* offset of the cell relative to the data pointer. */
+  int offset;
+  /* offset of the target cell relative to the cell, for multiply instruction only. */
+  int target;
+  /* constant bytes to output in the arena of AST, for write instruction only; the parameter is the length. */
+  unsigned char* bytes;
 } *Instruction;
 
+/**
+ * Source location of command, the column counts bytes.
+ */
+typedef struct _Location {
+  int line;
+  int column;
+} Location;
+
 typedef enum {
   InstructionNode = 0,
-  BlockNode
+  /* loop begin. */
+  BlockNode,
+  /* loop end. */
+  BlockEndNode
 } NodeType;
 
-typedef struct _Ast {
+typedef struct _Node {
   NodeType type;
   union {
-    struct _Instruction* instruction;
-    struct _Ast* block;
+    struct _Instruction instruction;
+    struct {
+      /* index of the matching loop end of block node, or the matching loop begin of block end node. */
+      int jump;
+      /* source location of `[` for block node. */
+      Location location;
+    };
   };
-  struct _Ast* previous;
-} *Ast;
-
-extern Ast AstRoot;
+} *Node;
 
-Instruction NewInstruction(InstructionSymbol, int);
-void DisposeInstruction(Instruction);
+/**
+ * AST in program order: all nodes are kept in one array, the body of loop lies between its block and block end node.
+ * The constant bytes of write instructions are allocated in chunks owned by the AST, freed all at once.
+ */
+typedef struct _Ast {
+  struct _Node* nodes;
+  int count;
+  int capacity;
+  struct _Chunk* chunks;
+} *Ast;
 
-Ast NewInstructionNode(NodeType, Instruction, Ast);
-Ast NewBlockNode(NodeType, Ast, Ast);
+Ast NewAst(void);
 void DisposeAst(Ast);
 
-void OptimizeAst(Ast);
+Node AppendNode(Ast, NodeType);
+Node AppendInstruction(Ast, InstructionSymbol, int);
+Node MergeInstruction(Ast, InstructionSymbol, int);
+unsigned char* AllocateBytes(Ast, int);
+
+Ast OptimizeAst(Ast, Report);
 
 #endif
@@ -0,0 +1,94 @@
+/**
+ * Batch compiler: compile many source files concurrently on a pool of worker threads.
+ * LLVM and the embedded runtime are set up once, each worker reuses its engine for its source files.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "options.h"
+#include "engine.h"
+#include "compiler.h"
+#include "linker.h"
+#include "batch.h"
+
+/* Index of the next source file to compile. */
+static atomic_int next = 0;
+
+/* Set if any source file is invalid. */
+static atomic_bool failed = false;
+
+/**
+ * Worker thread: take the next source file until all are compiled,
+ * and emit its output of the same mode as a single source file, no output for an invalid source file.
+ */
+static void* CompileSources(void* argument) {
+  Engine engine = NewEngine(options.optimizationLevel);
+  while (true) {
+    int index = atomic_fetch_add(&next, 1);
+    if (index >= options.sourceCount) {
+      break;
+    }
+
+    struct _Options job = options;
+    job.source = options.sources[index];
+    job.output = options.outputs[index];
+    job.report = NewReport(job.source, job.timeReport);
+    if (!Compile(engine, &job, job.source)) {
+      atomic_store(&failed, true);
+      DisposeReport(job.report);
+      continue;
+    }
+    switch (job.mode) {
+    case CompileMode:
+      BeginPhase(job.report, EmitPhase);
+      EmitObjectFile(engine, job.output);
+      EndPhase(job.report, EmitPhase);
+      break;
+    case RepresentationMode:
+      BeginPhase(job.report, EmitPhase);
+      EmitIntermediateRepresentation(engine, job.output);
+      EndPhase(job.report, EmitPhase);
+      break;
+    default:
+      Link(engine, &job, job.output);
+      break;
+    }
+    ReportOutput(job.report, job.output);
+    PrintReport(job.report, stderr);
+    DisposeReport(job.report);
+  }
+  DisposeEngine(engine);
+  return NULL;
+}
+
+/**
+ * Compile all source files with up to the jobs count of worker threads, return the exit status.
+ */
+int CompileBatch(void) {
+  SetUpEngine();
+  if (options.mode == LinkMode) {
+    SetUpLinker();
+  }
+
+  int count = options.jobs < options.sourceCount ? options.jobs : options.sourceCount;
+  pthread_t* workers = (pthread_t*)calloc(sizeof(pthread_t), count);
+  for (int index = 0; index < count; index++) {
+    if (pthread_create(&workers[index], NULL, CompileSources, NULL) != 0) {
+      fprintf(stderr, "Create worker thread failed!\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (int index = 0; index < count; index++) {
+    pthread_join(workers[index], NULL);
+  }
+  free(workers);
+
+  if (options.mode == LinkMode) {
+    TearDownLinker();
+  }
+  TearDownEngine();
+  return atomic_load(&failed) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,6 @@
+#ifndef __BATCH_H_
+#define __BATCH_H_
+
+int CompileBatch(void);
+
+#endif
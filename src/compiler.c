@@ -2,12 +2,19 @@
  * Brainfuck language command builder.
  */
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "options.h"
 #include "engine.h"
-#include "scanner.h"
 #include "parser.h"
 #include "ast.h"
+#include "evaluator.h"
+#include "runtime.h"
+#include "profile.h"
 #include "compiler.h"
 
 /**
@@ -16,118 +23,300 @@
 typedef struct _Stack {
   LLVMBasicBlockRef entry;
   LLVMBasicBlockRef body;
+  /* profile of the source loop recorded by the instrumented program, NULL if unknown. */
+  LoopProfile* recorded;
   struct _Stack* next;
 } *Stack;
-Stack stack = NULL;
+
+/**
+ * Imported external function symbols.
+ */
+typedef enum {
+  s_setup = 0,
+  s_read,
+  s_write,
+  s_write_bytes,
+  s_flush,
+  s_map_tape,
+  s_profile,
+  /* the function being built: main, or the compiled loop. */
+  s_main,
+  s_count
+} Symbol;
+
+/**
+ * Compilation state of one module, see Compile and CompileLoop.
+ */
+struct _Compiler {
+  Engine engine;
+  Options options;
+
+  /* blocks of the loops being built. */
+  Stack stack;
+
+  /* symbol table, fixed size. */
+  struct {
+    LLVMTypeRef types[s_count];
+    LLVMValueRef values[s_count];
+  } symbols;
+
+  /* data segment. */
+  LLVMValueRef ds;
+
+  /* global variable holding the data segment mapped at runtime, NULL if the data segment is constant. */
+  LLVMValueRef mapping;
+
+  /* data pointer. */
+  LLVMValueRef dp;
+
+  /* value of the data pointer loaded in current basic block. */
+  LLVMValueRef base;
+
+  /* count of outlined loops. */
+  int loops;
+
+  /* loop counters of instrumented program: i64 array of LoopProfile, NULL unless profiling. */
+  LLVMValueRef counters;
+
+  /* count of loops instrumented, loops are numbered in program order. */
+  int profiled;
+
+  /* loop profile to optimize with, NULL without profile. */
+  Profile profile;
+};
+
+/* Count of i64 fields of loop profile, and index of the field. */
+#define PROFILE_FIELD_COUNT (sizeof(LoopProfile) / sizeof(int64_t))
+#define PROFILE_FIELD(field) (offsetof(LoopProfile, field) / sizeof(int64_t))
 
 /**
  * Obtain the top loop entry block.
  */
-static LLVMBasicBlockRef CurrentEntryBlock() {
-  return stack != NULL? stack->entry: NULL;
+static LLVMBasicBlockRef CurrentEntryBlock(Compiler compiler) {
+  return compiler->stack != NULL? compiler->stack->entry: NULL;
 }
 
 /**
  * Obtain the top loop body block.
  */
-static LLVMBasicBlockRef CurrentBodyBlock() {
-  return stack != NULL? stack->body: NULL;
+static LLVMBasicBlockRef CurrentBodyBlock(Compiler compiler) {
+  return compiler->stack != NULL? compiler->stack->body: NULL;
 }
 
 /**
  * Push the block to top.
  */
-static void StackPush(LLVMBasicBlockRef entry, LLVMBasicBlockRef body) {
+static void StackPush(Compiler compiler, LLVMBasicBlockRef entry, LLVMBasicBlockRef body) {
   Stack top = (Stack)calloc(sizeof(struct _Stack), 1);
   top->entry = entry;
   top->body = body;
-  top->next = stack;
-  stack = top;
+  top->next = compiler->stack;
+  compiler->stack = top;
 }
 
 /**
  * Pop the top block.
  */
-static void StackPop() {
-  if (stack != NULL) {
-    Stack top = stack;
-    stack = stack->next;
+static void StackPop(Compiler compiler) {
+  if (compiler->stack != NULL) {
+    Stack top = compiler->stack;
+    compiler->stack = compiler->stack->next;
     free(top);
   }
 }
 
 /**
- * Imported external function symbols.
+ * Import function.
  */
-typedef enum {
-  s_getchar = 0,
-  s_putchar,
-  s_max,
-  s_main,
-  s_count
-} Symbol;
+static LLVMValueRef DefineFunction(Compiler compiler, Symbol symbol, char* name, LLVMTypeRef type, void* value) {
+  Engine engine = compiler->engine;
+  compiler->symbols.types[symbol] = type;
+  compiler->symbols.values[symbol] = value == NULL ? DeclareFunction(engine, name, type) : DeclareExternalFunction(engine, name, type, value);
+  return compiler->symbols.values[symbol];
+}
 
 /**
- * Static symbol table, fixed size.
+ * Call imported function.
  */
-static struct {
-  LLVMTypeRef types[s_count];
-  LLVMValueRef values[s_count];
-} SymbolTable;
+static LLVMValueRef InvokeFunction(Compiler compiler, Symbol symbol, int length, LLVMValueRef* parameters) {
+  Engine engine = compiler->engine;
+  LLVMTypeRef type = compiler->symbols.types[symbol];
+  LLVMValueRef fn = compiler->symbols.values[symbol];
+  return CallFunction(engine, type, fn, length, parameters);
+}
 
 /**
- * Import function.
+ * Get value of the data pointer, load once per basic block.
  */
-static LLVMValueRef DefineFunction(Symbol symbol, char* name, LLVMTypeRef type, void* value) {
-  SymbolTable.types[symbol] = type;
-  SymbolTable.values[symbol] = value == NULL ? DeclareFunction(name, type) : DeclareExternalFunction(name, type, value);
-  return SymbolTable.values[symbol];
+static LLVMValueRef GetDataPointer(Compiler compiler) {
+  Engine engine = compiler->engine;
+  if (compiler->base == NULL) {
+    compiler->base = Load(engine, Int8PointerType(engine), compiler->dp);
+  }
+  return compiler->base;
 }
 
 /**
- * Call imported function.
+ * Set value to the data pointer.
  */
-static LLVMValueRef InvokeFunction(Symbol symbol, int length, LLVMValueRef* parameters) {
-  LLVMTypeRef type = SymbolTable.types[symbol];
-  LLVMValueRef fn = SymbolTable.values[symbol];
-  return CallFunction(type, fn, length, parameters);
+static void SetDataPointer(Compiler compiler, LLVMValueRef pointer) {
+  Engine engine = compiler->engine;
+  Store(engine, compiler->dp, pointer);
+  compiler->base = pointer;
 }
 
-/* Data Pointer */
-static LLVMValueRef dp = NULL;
+/**
+ * Get pointer of the cell with offset relative to the data pointer.
+ */
+static LLVMValueRef GetCell(Compiler compiler, int offset) {
+  Engine engine = compiler->engine;
+  LLVMValueRef pointer = GetDataPointer(compiler);
+  if (offset == 0) {
+    return pointer;
+  }
+  return GetPointer(engine, Int8Type(engine), pointer, 1, (LLVMValueRef[]){ Int32(engine, offset) });
+}
 
 /**
- * Get value of the data pointer.
+ * Get value of the cell with offset relative to the data pointer.
  */
-static LLVMValueRef GetValue() {
-  LLVMValueRef pointer = Load(Int8PointerType, dp);
-  return Load(LLVMInt8Type(), pointer);
+static LLVMValueRef GetValue(Compiler compiler, int offset) {
+  Engine engine = compiler->engine;
+  return Load(engine, Int8Type(engine), GetCell(compiler, offset));
 }
 
 /**
- * Set value to the data pointer.
+ * Set value to the cell with offset relative to the data pointer.
+ */
+static void SetValue(Compiler compiler, int offset, LLVMValueRef value) {
+  Engine engine = compiler->engine;
+  Store(engine, GetCell(compiler, offset), value);
+}
+
+/**
+ * Get pointer to the first cell, load the mapped one in current function.
  */
-static void SetValue(LLVMValueRef value) {
-  LLVMValueRef pointer = Load(Int8PointerType, dp);
-  Store(pointer, value);
+static LLVMValueRef GetDataSegment(Compiler compiler) {
+  Engine engine = compiler->engine;
+  return compiler->mapping != NULL ? Load(engine, Int8PointerType(engine), compiler->mapping) : compiler->ds;
 }
 
 /**
- * Create global data segment and return the data pointer.
+ * Create global data segment in BSS and return the data pointer.
  */
-static LLVMValueRef DefineDataSegment() {
-  LLVMTypeRef type = LLVMArrayType(LLVMInt8Type(), DATA_SEGMENT_SIZE);
-  LLVMValueRef initializer = CreateZeroInitializer(LLVMInt8Type(), DATA_SEGMENT_SIZE);
-  LLVMValueRef ds = DeclareGlobalVariableWithValue("ds", type, initializer);
-  return GetPointer(type, ds, 2, (LLVMValueRef[]){ Int32(0), Int32(0) });
+static LLVMValueRef DefineDataSegment(Compiler compiler, long size) {
+  Engine engine = compiler->engine;
+  LLVMTypeRef type = LLVMArrayType(Int8Type(engine), size);
+  LLVMValueRef segment = DeclareGlobalVariableWithValue(engine, "ds", type, LLVMConstNull(type));
+  LLVMSetLinkage(segment, LLVMInternalLinkage);
+  LLVMSetAlignment(segment, SCAN_VECTOR_WIDTH);
+  return LLVMConstPointerCast(segment, Int8PointerType(engine));
+}
+
+/**
+ * Copy the tape snapshot to data segment, only the bytes before the last non-zero byte.
+ */
+static void RestoreDataSegment(Compiler compiler, unsigned char* tape, int size) {
+  Engine engine = compiler->engine;
+  int length = size;
+  while (length > 0 && tape[length - 1] == 0) {
+    length--;
+  }
+  if (length > 0) {
+    CopyMemory(engine, GetDataSegment(compiler), DeclareConstantString(engine, tape, length), length);
+  }
 }
 
 /**
  * Create basic block and append to main function.
  */
-static LLVMBasicBlockRef NewBlock() {
-  LLVMValueRef fn = SymbolTable.values[s_main];
-  return CreateAndAppendBlock(fn);
+static LLVMBasicBlockRef NewBlock(Compiler compiler) {
+  Engine engine = compiler->engine;
+  LLVMValueRef fn = compiler->symbols.values[s_main];
+  return CreateAndAppendBlock(engine, fn);
+}
+
+/**
+ * Move builder to the end of block, and forget the loaded data pointer.
+ */
+static void EnterCommandBlock(Compiler compiler, LLVMBasicBlockRef block) {
+  Engine engine = compiler->engine;
+  EnterBlock(engine, block);
+  compiler->base = NULL;
+}
+
+/* Profile */
+
+/**
+ * Create global loop profiles of the AST with source locations and operations per iteration,
+ * the counters start from zero. Return the count of operations out of loops.
+ */
+static int64_t DefineLoopProfiles(Compiler compiler, Ast ast) {
+  Engine engine = compiler->engine;
+  int count = 0;
+  for (int index = 0; index < ast->count; index++) {
+    count += ast->nodes[index].type == BlockNode;
+  }
+
+  // each iteration checks the condition once, and runs the instructions directly in loop body.
+  LoopProfile* loops = (LoopProfile*)calloc(count + 1, sizeof(LoopProfile));
+  int* enclosing = (int*)calloc(count + 1, sizeof(int));
+  int depth = 0;
+  int loop = 0;
+  int64_t operations = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == BlockNode) {
+      loops[loop] = (LoopProfile){ 0, 0, node->location.line, node->location.column, 1 };
+      enclosing[depth++] = loop++;
+    } else if (node->type == BlockEndNode) {
+      depth--;
+    } else if (depth > 0) {
+      loops[enclosing[depth - 1]].operations++;
+    } else {
+      operations++;
+    }
+  }
+
+  int length = count * PROFILE_FIELD_COUNT;
+  LLVMValueRef* fields = (LLVMValueRef*)calloc(length + 1, sizeof(LLVMValueRef));
+  for (int index = 0; index < length; index++) {
+    fields[index] = Int64(engine, ((int64_t*)loops)[index]);
+  }
+  LLVMTypeRef type = LLVMArrayType(Int64Type(engine), length);
+  LLVMValueRef profiles = DeclareGlobalVariableWithValue(engine, "profiles", type, LLVMConstArray(Int64Type(engine), fields, length));
+  LLVMSetLinkage(profiles, LLVMInternalLinkage);
+  compiler->counters = LLVMConstPointerCast(profiles, LLVMPointerType(Int64Type(engine), EMPTY_SPACE));
+  free(fields);
+  free(enclosing);
+  free(loops);
+  return operations;
+}
+
+/**
+ * Increase the counter field of loop profile by one.
+ */
+static void CountLoop(Compiler compiler, int loop, int field) {
+  Engine engine = compiler->engine;
+  LLVMValueRef counter = GetPointer(engine, Int64Type(engine), compiler->counters, 1, (LLVMValueRef[]){ Int64(engine, loop * PROFILE_FIELD_COUNT + field) });
+  Store(engine, counter, Add(engine, Load(engine, Int64Type(engine), counter), Int64(engine, 1)));
+}
+
+/**
+ * Optimize the loop with its recorded profile: the condition branch enters the body on each iteration, and leaves the
+ * loop once per entry, LLVM places the blocks and estimates the trip count by the weights.
+ * The hot loops with long trips are unrolled, while the loops never entered or mostly run as a condition are neither
+ * unrolled nor vectorized.
+ */
+static void WeighLoop(Compiler compiler, LoopProfile* loop, LLVMValueRef branch, LLVMValueRef latch) {
+  Engine engine = compiler->engine;
+  SetBranchWeights(engine, branch, loop->iterations, loop->entries);
+  bool hot = loop->iterations * 100 >= ProfileIterations(compiler->profile) * PROFILE_HOT_PERCENTAGE;
+  if (loop->entries == 0 || loop->iterations < loop->entries * PROFILE_SHORT_TRIP_COUNT) {
+    SetLoopHints(engine, latch, 1, false);
+  } else if (hot && loop->iterations >= loop->entries * PROFILE_LONG_TRIP_COUNT) {
+    SetLoopHints(engine, latch, PROFILE_UNROLL_COUNT, true);
+  }
 }
 
 /* Eight Commands */
@@ -135,175 +324,497 @@ static LLVMBasicBlockRef NewBlock() {
 /**
  * Build command `[`: while loop begin.
  */
-void WhileNotZero(void) {
-  LLVMBasicBlockRef entry = NewBlock();
-  Goto(entry);
+void WhileNotZero(Compiler compiler) {
+  Engine engine = compiler->engine;
+  LLVMBasicBlockRef entry = NewBlock(compiler);
+  Goto(engine, entry);
+
+  LLVMBasicBlockRef body = NewBlock(compiler);
+  StackPush(compiler, entry, body);
+  EnterCommandBlock(compiler, body);
+}
 
-  LLVMBasicBlockRef body = NewBlock();
-  StackPush(entry, body);
-  EnterBlock(body);
+/**
+ * Build command `[` of the loop of block node in source: count the entry before the loop and the iteration at the
+ * beginning of loop body if profiling, and take the recorded profile of loop for WhileEnd if optimizing with one.
+ */
+static void WhileNotZeroInSource(Compiler compiler, Node node) {
+  int loop = compiler->profiled;
+  if (compiler->counters != NULL) {
+    compiler->profiled++;
+    CountLoop(compiler, loop, PROFILE_FIELD(entries));
+  }
+  WhileNotZero(compiler);
+  if (compiler->counters != NULL) {
+    CountLoop(compiler, loop, PROFILE_FIELD(iterations));
+  }
+  if (compiler->profile != NULL) {
+    compiler->stack->recorded = FindLoopProfile(compiler->profile, node->location.line, node->location.column);
+  }
 }
 
 /**
  * Build command `]`: while loop end.
  */
-void WhileEnd(void) {
+void WhileEnd(Compiler compiler) {
+  Engine engine = compiler->engine;
   // body
-  LLVMBasicBlockRef entry = CurrentEntryBlock();
-  Goto(entry);
+  LLVMBasicBlockRef entry = CurrentEntryBlock(compiler);
+  LLVMValueRef latch = Goto(engine, entry);
 
   // entry
-  EnterBlock(entry);
-  LLVMValueRef value = GetValue();
-  LLVMValueRef condition = Compare(LLVMIntNE, value, Int8(0));
-  LLVMBasicBlockRef body = CurrentBodyBlock();
-  LLVMBasicBlockRef end = NewBlock();
-  If(condition, body, end);
+  EnterCommandBlock(compiler, entry);
+  LLVMValueRef value = GetValue(compiler, 0);
+  LLVMValueRef condition = Compare(engine, LLVMIntNE, value, Int8(engine, 0));
+  LLVMBasicBlockRef body = CurrentBodyBlock(compiler);
+  LLVMBasicBlockRef end = NewBlock(compiler);
+  LLVMValueRef branch = If(engine, condition, body, end);
+  if (compiler->stack->recorded != NULL) {
+    WeighLoop(compiler, compiler->stack->recorded, branch, latch);
+  }
 
   // end
-  EnterBlock(end);
-  StackPop();
+  EnterCommandBlock(compiler, end);
+  StackPop(compiler);
 }
 
 /**
  * Bulid command `>` and `<`: move data pointer.
  */
-void MovePointer(int step) {
-  LLVMValueRef pointer = Load(Int8PointerType, dp);
-  Store(dp, GetPointer(LLVMInt8Type(), pointer, 1, (LLVMValueRef[]){ Int32(step) }));
+void MovePointer(Compiler compiler, int step) {
+  Engine engine = compiler->engine;
+  LLVMValueRef pointer = GetDataPointer(compiler);
+  SetDataPointer(compiler, GetPointer(engine, Int8Type(engine), pointer, 1, (LLVMValueRef[]){ Int32(engine, step) }));
 }
 
 /**
- * Build command `+` and `-`: apply offset to value of the data pointer.
+ * Build command `+` and `-`: apply delta to value of the cell.
  */
-void UpdateValue(int offset) {
-  LLVMValueRef value = GetValue();
-  if (offset > 0) {
-    value = Add(value, Int8(offset));
-  } else if (offset < 0) {
-    value = Sub(value, Int8(-offset));
+void UpdateValue(Compiler compiler, int offset, int delta) {
+  Engine engine = compiler->engine;
+  LLVMValueRef value = GetValue(compiler, offset);
+  if (delta > 0) {
+    value = Add(engine, value, Int8(engine, delta));
+  } else if (delta < 0) {
+    value = Sub(engine, value, Int8(engine, -delta));
   }
-  SetValue(value);
+  SetValue(compiler, offset, value);
+}
+
+/**
+ * Build clear loop `[-]`: assign constant to value of the cell.
+ */
+void AssignValue(Compiler compiler, int offset, int value) {
+  Engine engine = compiler->engine;
+  SetValue(compiler, offset, Int8(engine, value));
+}
+
+/**
+ * Build multiply loop `[->+++<]`: add value of the cell multiplied by factor to the target cell.
+ * The target cell may be out of the data segment if the cell is zero, see CompileMultiplications.
+ */
+void MultiplyValue(Compiler compiler, int offset, int target, int factor) {
+  Engine engine = compiler->engine;
+  LLVMValueRef value = GetValue(compiler, offset);
+  LLVMValueRef pointer = GetCell(compiler, offset + target);
+  LLVMValueRef product = factor == 1 ? value : Mul(engine, value, Int8(engine, factor));
+  Store(engine, pointer, Add(engine, Load(engine, Int8Type(engine), pointer), product));
+}
+
+/**
+ * Build scan loop `[>]`, `[<<]`: move data pointer by stride until a zero cell.
+ *
+ * While the vector of SCAN_VECTOR_WIDTH cells is inside the data segment,
+ * compare the whole vector with zero, mask the lanes on the stride,
+ * and count the trailing (forward) or leading (backward) zero bits to find the zero cell.
+ * Otherwise, near the bounds of data segment, fall back to scalar loop.
+ */
+void ScanPointer(Compiler compiler, int stride) {
+  Engine engine = compiler->engine;
+  int width = SCAN_VECTOR_WIDTH;
+  int distance = stride > 0 ? stride : -stride;
+  if (distance > SCAN_VECTOR_STRIDE_LIMIT) {
+    WhileNotZero(compiler);
+    MovePointer(compiler, stride);
+    WhileEnd(compiler);
+    return;
+  }
+
+  LLVMBasicBlockRef check = NewBlock(compiler);
+  LLVMBasicBlockRef vector = NewBlock(compiler);
+  LLVMBasicBlockRef hit = NewBlock(compiler);
+  LLVMBasicBlockRef next = NewBlock(compiler);
+  LLVMBasicBlockRef scalar = NewBlock(compiler);
+  LLVMBasicBlockRef step = NewBlock(compiler);
+  LLVMBasicBlockRef end = NewBlock(compiler);
+  Goto(engine, check);
+
+  // check: vector inside data segment
+  EnterCommandBlock(compiler, check);
+  LLVMValueRef pointer = GetDataPointer(compiler);
+  LLVMValueRef segment = GetDataSegment(compiler);
+  LLVMValueRef inside = stride > 0
+    ? Compare(engine, LLVMIntULE, pointer, GetPointer(engine, Int8Type(engine), segment, 1, (LLVMValueRef[]){ Int64(engine, compiler->options->tapeSize - width) }))
+    : Compare(engine, LLVMIntUGE, pointer, GetPointer(engine, Int8Type(engine), segment, 1, (LLVMValueRef[]){ Int64(engine, width - 1) }));
+  If(engine, inside, vector, scalar);
+
+  // vector: find zero lanes on the stride
+  EnterCommandBlock(compiler, vector);
+  unsigned int mask = 0;
+  for (int lane = 0; lane < width; lane += distance) {
+    mask |= 1u << (stride > 0 ? lane : width - 1 - lane);
+  }
+  LLVMTypeRef vectorType = LLVMVectorType(Int8Type(engine), width);
+  LLVMTypeRef bitsType = IntType(engine, width);
+  LLVMValueRef first = stride > 0 ? pointer : GetPointer(engine, Int8Type(engine), pointer, 1, (LLVMValueRef[]){ Int32(engine, 1 - width) });
+  LLVMValueRef values = Load(engine, vectorType, CastPointer(engine, first, LLVMPointerType(vectorType, EMPTY_SPACE)));
+  LLVMSetAlignment(values, 1);
+  LLVMValueRef zeros = Compare(engine, LLVMIntEQ, values, LLVMConstNull(vectorType));
+  LLVMValueRef bits = And(engine, CastType(engine, zeros, bitsType), LLVMConstInt(bitsType, mask, false));
+  If(engine, Compare(engine, LLVMIntNE, bits, LLVMConstNull(bitsType)), hit, next);
+
+  // hit: move to the first zero lane
+  EnterCommandBlock(compiler, hit);
+  LLVMValueRef zeroPoison = LLVMConstInt(Int1Type(engine), 1, false);
+  LLVMValueRef lane = stride > 0
+    ? CallIntrinsic(engine, "llvm.cttz", bitsType, 2, (LLVMValueRef[]){ bits, zeroPoison })
+    : Sub(engine, LLVMConstNull(bitsType), CallIntrinsic(engine, "llvm.ctlz", bitsType, 2, (LLVMValueRef[]){ bits, zeroPoison }));
+  SetDataPointer(compiler, GetPointer(engine, Int8Type(engine), pointer, 1, (LLVMValueRef[]){ lane }));
+  Goto(engine, end);
+
+  // next: skip the whole vector
+  EnterCommandBlock(compiler, next);
+  int advance = (width + distance - 1) / distance * stride;
+  SetDataPointer(compiler, GetPointer(engine, Int8Type(engine), pointer, 1, (LLVMValueRef[]){ Int32(engine, advance) }));
+  Goto(engine, check);
+
+  // scalar: byte-at-a-time loop
+  EnterCommandBlock(compiler, scalar);
+  LLVMValueRef value = GetValue(compiler, 0);
+  If(engine, Compare(engine, LLVMIntEQ, value, Int8(engine, 0)), end, step);
+
+  EnterCommandBlock(compiler, step);
+  MovePointer(compiler, stride);
+  Goto(engine, check);
+
+  EnterCommandBlock(compiler, end);
 }
 
 /**
  * Build command ','.
  */
-void InputValue(void) {
-  LLVMValueRef value = InvokeFunction(s_getchar, 0, (LLVMValueRef[]){});
-  value = InvokeFunction(s_max, 2, (LLVMValueRef[]){ value, Int32(0) });
-  value = TruncateType(value, LLVMInt8Type());
-  SetValue(value);
+void InputValue(Compiler compiler, int offset) {
+  Engine engine = compiler->engine;
+  LLVMValueRef value = InvokeFunction(compiler, s_read, 0, (LLVMValueRef[]){});
+  value = Select(engine, Compare(engine, LLVMIntSLT, value, Int32(engine, 0)), Int32(engine, 0), value);
+  value = TruncateType(engine, value, Int8Type(engine));
+  SetValue(compiler, offset, value);
 }
 
 /**
  * Build command '.'.
  */
-void OutputValue(void) {
-  LLVMValueRef value = GetValue();
-  LLVMValueRef charactor = ExtendType(value, LLVMInt32Type());
-  InvokeFunction(s_putchar, 1, (LLVMValueRef[]){ charactor });
+void OutputValue(Compiler compiler, int offset) {
+  Engine engine = compiler->engine;
+  LLVMValueRef value = GetValue(compiler, offset);
+  LLVMValueRef charactor = ExtendType(engine, value, Int32Type(engine));
+  InvokeFunction(compiler, s_write, 1, (LLVMValueRef[]){ charactor });
+}
+
+/**
+ * Build constant outputs: write the bytes at once.
+ */
+void WriteBytes(Compiler compiler, unsigned char* bytes, int length) {
+  Engine engine = compiler->engine;
+  LLVMValueRef string = DeclareConstantString(engine, bytes, length);
+  InvokeFunction(compiler, s_write_bytes, 2, (LLVMValueRef[]){ string, Int32(engine, length) });
 }
 
 /* Compiler */
 
 /**
- * Remove all blocks.
+ * Return the count of nodes, each loop counts as one node with its body.
+ */
+static int CountAstNodes(Ast ast) {
+  int count = 0;
+  for (int index = 0; index < ast->count; index++) {
+    count += ast->nodes[index].type != BlockEndNode;
+  }
+  return count;
+}
+
+/**
+ * Compile instruction to LLVM IR.
  */
-void TearDownCompiler(void) {
-  TearDownEngine();
-  while (stack != NULL) {
-    StackPop();
+static void CompileInstruction(Compiler compiler, Instruction instruction) {
+  switch (instruction->symbol) {
+  case UpdateInstruction:
+    UpdateValue(compiler, instruction->offset, instruction->parameter);
+    break;
+  case MoveInstruction:
+    MovePointer(compiler, instruction->parameter);
+    break;
+  case InputInstruction:
+    InputValue(compiler, instruction->offset);
+    break;
+  case OutputInstruction:
+    OutputValue(compiler, instruction->offset);
+    break;
+  case SetInstruction:
+    AssignValue(compiler, instruction->offset, instruction->parameter);
+    break;
+  case MultiplyInstruction:
+    MultiplyValue(compiler, instruction->offset, instruction->target, instruction->parameter);
+    break;
+  case ScanInstruction:
+    ScanPointer(compiler, instruction->parameter);
+    break;
+  case WriteInstruction:
+    WriteBytes(compiler, instruction->bytes, instruction->parameter);
+    break;
+  default:
+    /* Unknown Instruction */
+    break;
   }
-  DisposeAst(AstRoot);
 }
 
 /**
- * Setup brainfuck skeleton.
- * - declare getchar.
- * - declare putchar.
- * - declare max.
- * - declare global data segment.
- * - create data pointer.
+ * Return if the node is a multiply instruction on the cell with offset.
  */
-void SetUpCompiler(void) {
-  SetUpEngine();
+static bool IsMultiplication(Node node, int offset) {
+  return node->type == InstructionNode
+      && node->instruction.symbol == MultiplyInstruction
+      && node->instruction.offset == offset;
 }
 
 /**
- * Compile AST to LLVM IR.
+ * Compile the serial multiply instructions of a linear loop from the index, until the end of range.
+ * The loop body never runs if the loop cell is zero, so the target cells are updated in a branch only taken if it's
+ * not: they may be out of the data segment otherwise. Return the index of the last multiply instruction.
  */
-static void CompileAst(Ast ast) {
-  if (ast->previous != NULL) {
-    CompileAst(ast->previous);
+static int CompileMultiplications(Compiler compiler, Ast ast, int index, int end) {
+  Engine engine = compiler->engine;
+  int offset = ast->nodes[index].instruction.offset;
+  LLVMBasicBlockRef body = NewBlock(compiler);
+  LLVMBasicBlockRef next = NewBlock(compiler);
+  If(engine, Compare(engine, LLVMIntNE, GetValue(compiler, offset), Int8(engine, 0)), body, next);
+
+  EnterCommandBlock(compiler, body);
+  for (; index < end && IsMultiplication(&ast->nodes[index], offset); index++) {
+    CompileInstruction(compiler, &ast->nodes[index].instruction);
   }
-  if (ast->type == BlockNode) {
-    WhileNotZero();
-    CompileAst(ast->block);
-    WhileEnd();
-  } else {
-    switch (ast->instruction->symbol) {
-    case UpdateInstruction:
-      UpdateValue(ast->instruction->parameter);
-      break;
-    case MoveInstruction:
-      MovePointer(ast->instruction->parameter);
-      break;
-    case InputInstruction:
-      InputValue();
-      break;
-    case OutputInstruction:
-      OutputValue();
-      break;
-    default:
-      /* Unknown Instruction */
-      break;
+  Goto(engine, next);
+  EnterCommandBlock(compiler, next);
+  return index - 1;
+}
+
+static void CompileAst(Compiler, Ast, int, int, bool);
+
+/**
+ * Define function `i8* name(i8*)` for the loop of block node at the index:
+ * take the data pointer at loop entry, return the data pointer at loop end.
+ */
+static LLVMValueRef DefineLoopFunction(Compiler compiler, Ast ast, int loop, char* name) {
+  Engine engine = compiler->engine;
+  LLVMValueRef fn = DefineFunction(compiler, s_main, name, LLVMFunctionType(Int8PointerType(engine), (LLVMTypeRef[]){ Int8PointerType(engine) }, 1, false), NULL);
+  EnterCommandBlock(compiler, NewBlock(compiler));
+  compiler->dp = Alloc(engine, Int8PointerType(engine));
+  SetDataPointer(compiler, LLVMGetParam(fn, 0));
+
+  CompileAst(compiler, ast, loop, ast->nodes[loop].jump + 1, false);
+  Return(engine, GetDataPointer(compiler));
+  return fn;
+}
+
+/**
+ * Outline the top level loop to its own function and call it, the JIT compiles it at the first call.
+ */
+static void CallLoop(Compiler compiler, Ast ast, int loop) {
+  Engine engine = compiler->engine;
+  LLVMValueRef pointer = GetDataPointer(compiler);
+  LLVMBasicBlockRef block = CurrentBlock(engine);
+  LLVMTypeRef callerType = compiler->symbols.types[s_main];
+  LLVMValueRef caller = compiler->symbols.values[s_main];
+  LLVMValueRef callerDataPointer = compiler->dp;
+
+  char name[32];
+  snprintf(name, sizeof(name), "loop%d", ++compiler->loops);
+  LLVMValueRef fn = DefineLoopFunction(compiler, ast, loop, name);
+  LLVMTypeRef type = compiler->symbols.types[s_main];
+
+  compiler->symbols.types[s_main] = callerType;
+  compiler->symbols.values[s_main] = caller;
+  compiler->dp = callerDataPointer;
+  EnterCommandBlock(compiler, block);
+  SetDataPointer(compiler, CallFunction(engine, type, fn, 1, (LLVMValueRef[]){ pointer }));
+}
+
+/**
+ * Compile the nodes in the range to LLVM IR in program order, outline the loops if required.
+ */
+static void CompileAst(Compiler compiler, Ast ast, int begin, int end, bool outlined) {
+  for (int index = begin; index < end; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == BlockNode && outlined) {
+      CallLoop(compiler, ast, index);
+      index = node->jump;
+    } else if (node->type == BlockNode) {
+      WhileNotZeroInSource(compiler, node);
+    } else if (node->type == BlockEndNode) {
+      WhileEnd(compiler);
+    } else if (node->instruction.symbol == MultiplyInstruction) {
+      index = CompileMultiplications(compiler, ast, index, end);
+    } else {
+      CompileInstruction(compiler, &node->instruction);
     }
   }
 }
 
 /**
- * Compile to default module.
+ * Record the statistics of default module in report.
  */
-void Compile(char* source) {
-  SetDefaultModule(source);
+static void ReportDefaultModule(Compiler compiler, char* stage) {
+  if (compiler->options->report != NULL) {
+    int functions, blocks, instructions;
+    CountModule(compiler->engine, &functions, &blocks, &instructions);
+    ReportModule(compiler->options->report, stage, functions, blocks, instructions);
+  }
+}
 
-  // Global Variables
-  LLVMValueRef ds = DefineDataSegment();
+/**
+ * Import runtime functions to default module, mapped to the ones of this process for JIT.
+ */
+static void DefineRuntimeFunctions(Compiler compiler) {
+  Engine engine = compiler->engine;
+  DefineFunction(compiler, s_setup, "bf_setup", LLVMFunctionType(VoidType(engine), (LLVMTypeRef[]){ Int32Type(engine), Int32Type(engine) }, 2, false), bf_setup);
+  DefineFunction(compiler, s_read, "bf_read", LLVMFunctionType(Int32Type(engine), (LLVMTypeRef[]){}, 0, false), bf_read);
+  DefineFunction(compiler, s_write, "bf_write", LLVMFunctionType(VoidType(engine), (LLVMTypeRef[]){ Int32Type(engine) }, 1, false), bf_write);
+  DefineFunction(compiler, s_write_bytes, "bf_write_bytes", LLVMFunctionType(VoidType(engine), (LLVMTypeRef[]){ Int8PointerType(engine), Int32Type(engine) }, 2, false), bf_write_bytes);
+  DefineFunction(compiler, s_flush, "bf_flush", LLVMFunctionType(VoidType(engine), (LLVMTypeRef[]){}, 0, false), bf_flush);
+  DefineFunction(compiler, s_map_tape, "bf_map_tape", LLVMFunctionType(Int8PointerType(engine), (LLVMTypeRef[]){ Int64Type(engine) }, 1, false), bf_map_tape);
+  if (compiler->options->profile) {
+    DefineFunction(compiler, s_profile, "bf_profile", LLVMFunctionType(VoidType(engine), (LLVMTypeRef[]){ LLVMPointerType(Int64Type(engine), EMPTY_SPACE), Int32Type(engine), Int64Type(engine), Int8PointerType(engine) }, 4, false), bf_profile);
+  }
+}
 
-  // External Functions
-  DefineFunction(s_getchar, "getchar", LLVMFunctionType(LLVMInt32Type(), (LLVMTypeRef[]){}, 0, false), getchar);
-  DefineFunction(s_putchar, "putchar", LLVMFunctionType(LLVMInt32Type(), (LLVMTypeRef[]){ LLVMInt32Type() }, 1, false), putchar);
+/**
+ * Create compiler state for the module of engine.
+ */
+static void SetUpCompiler(Compiler compiler, Engine engine, Options options) {
+  memset(compiler, 0, sizeof(struct _Compiler));
+  compiler->engine = engine;
+  compiler->options = options;
+}
 
-  // Global Functions
-  LLVMValueRef max = DefineFunction(s_max, "max", LLVMFunctionType(LLVMInt32Type(), (LLVMTypeRef[]){ LLVMInt32Type(), LLVMInt32Type() }, 2, false), NULL);
-  EnterBlock(CreateAndAppendBlock(max));
-  LLVMValueRef condition = Compare(LLVMIntSGT, LLVMGetParam(max, 0), LLVMGetParam(max, 1));
-  LLVMBasicBlockRef then = CreateAndAppendBlock(max);
-  LLVMBasicBlockRef otherwise = CreateAndAppendBlock(max);
-  If(condition, then, otherwise);
-  EnterBlock(then);
-  Return(LLVMGetParam(max, 0));
-  EnterBlock(otherwise);
-  Return(LLVMGetParam(max, 1));
+/**
+ * Remove all blocks and the profile.
+ */
+static void TearDownCompiler(Compiler compiler) {
+  while (compiler->stack != NULL) {
+    StackPop(compiler);
+  }
+  DisposeProfile(compiler->profile);
+  compiler->profile = NULL;
+}
 
-  // Main Begin
-  DefineFunction(s_main, "main", LLVMFunctionType(LLVMInt32Type(), (LLVMTypeRef[]){}, 0, false), NULL);
-  EnterBlock(NewBlock());
+/**
+ * Compile the source file to the default module of engine, return false if the source is invalid.
+ */
+bool Compile(Engine engine, Options options, char* source) {
+  struct _Compiler state;
+  Compiler compiler = &state;
+  SetUpCompiler(compiler, engine, options);
+  SetDefaultModule(engine, source);
+  Report report = options->report;
+
+  // Front End
+  BeginPhase(report, ParsePhase);
+  Ast root = ParseSource(source, options);
+  EndPhase(report, ParsePhase);
+  if (root == NULL) {
+    return false;
+  }
+  BeginPhase(report, OptimizePhase);
+  root = OptimizeAst(root, report);
+  EndPhase(report, OptimizePhase);
+  if (options->profileUse != NULL) {
+    compiler->profile = LoadProfile(options->profileUse);
+  }
+
+  // Partial Evaluation: the executable file starts from the snapshot, the profiled one runs all loops.
+  int evaluated = options->tapeSize < EVALUATION_TAPE_LIMIT ? (int)options->tapeSize : EVALUATION_TAPE_LIMIT;
+  unsigned char* tape = (unsigned char*)calloc(sizeof(unsigned char), evaluated);
+  if (options->mode != ScriptingMode && options->optimizationLevel > 0 && !options->profile) {
+    BeginPhase(report, EvaluatePhase);
+    root = EvaluateAst(root, tape, evaluated, EVALUATION_STEP_LIMIT);
+    EndPhase(report, EvaluatePhase);
+    ReportAstNodes(report, "evaluated", root->count);
+  }
 
-  dp = Alloc(Int8PointerType);
-  Store(dp, ds);
+  // Runtime Functions
+  BeginPhase(report, GeneratePhase);
+  DefineRuntimeFunctions(compiler);
 
-  // Main Body
-  yyin = fopen(source, "r");
-  if (yyin == NULL) {
-    fprintf(stderr, "Open source file %s failed!\n", source);
-    exit(EXIT_FAILURE);
+  // Main Begin
+  DefineFunction(compiler, s_main, "main", LLVMFunctionType(Int32Type(engine), (LLVMTypeRef[]){}, 0, false), NULL);
+  EnterBlock(engine, NewBlock(compiler));
+  InvokeFunction(compiler, s_setup, 2, (LLVMValueRef[]){ Int32(engine, options->bufferSize), Int32(engine, options->lineBuffered) });
+
+  // Data Segment: mapped at runtime with guard pages, or a global variable.
+  if (options->guardedTape) {
+    compiler->mapping = DeclareGlobalVariableWithValue(engine, "tape", Int8PointerType(engine), LLVMConstNull(Int8PointerType(engine)));
+    LLVMSetLinkage(compiler->mapping, LLVMInternalLinkage);
+    Store(engine, compiler->mapping, InvokeFunction(compiler, s_map_tape, 1, (LLVMValueRef[]){ Int64(engine, options->tapeSize) }));
+  } else {
+    compiler->ds = DefineDataSegment(compiler, options->tapeSize);
   }
-  yyparse();
-  OptimizeAst(AstRoot);
-  CompileAst(AstRoot);
+  RestoreDataSegment(compiler, tape, evaluated);
+  free(tape);
+
+  compiler->dp = Alloc(engine, Int8PointerType(engine));
+  SetDataPointer(compiler, GetDataSegment(compiler));
+  int64_t operations = options->profile ? DefineLoopProfiles(compiler, root) : 0;
+
+  // Main Body: top level loops of large scripts are outlined, to be compiled at their first call.
+  CompileAst(compiler, root, 0, root->count, options->mode == ScriptingMode && CountAstNodes(root) >= LAZY_COMPILATION_THRESHOLD);
 
   // Main End
-  Return(Int32(0));
+  InvokeFunction(compiler, s_flush, 0, (LLVMValueRef[]){});
+  if (compiler->counters != NULL) {
+    char* file = options->profileFile;
+    LLVMValueRef filename = file != NULL ? DeclareConstantString(engine, (unsigned char*)file, strlen(file) + 1) : LLVMConstNull(Int8PointerType(engine));
+    InvokeFunction(compiler, s_profile, 4, (LLVMValueRef[]){ compiler->counters, Int32(engine, compiler->profiled), Int64(engine, operations), filename });
+  }
+  Return(engine, Int32(engine, 0));
+
+  TearDownCompiler(compiler);
+  DisposeAst(root);
+  EndPhase(report, GeneratePhase);
+  ReportDefaultModule(compiler, "generated");
+
+  // The JIT optimizes each function before compiling it.
+  if (options->mode != ScriptingMode) {
+    BeginPhase(report, OptimizeModulePhase);
+    OptimizeModule(engine);
+    EndPhase(report, OptimizeModulePhase);
+    ReportDefaultModule(compiler, "optimized");
+  }
+  return true;
+}
+
+/**
+ * Compile the loop of block node at the index to a new module of engine with the tape of interpreter,
+ * return its machine code.
+ */
+LoopFunction CompileLoop(Engine engine, Options options, Ast ast, int loop, unsigned char* tape, char* name) {
+  struct _Compiler state;
+  Compiler compiler = &state;
+  SetUpCompiler(compiler, engine, options);
+  SetDefaultModule(engine, name);
+  DefineRuntimeFunctions(compiler);
+  compiler->ds = LLVMConstIntToPtr(Int64(engine, (uintptr_t)tape), Int8PointerType(engine));
+
+  DefineLoopFunction(compiler, ast, loop, name);
+  TearDownCompiler(compiler);
+  return (LoopFunction)GetMachineCode(engine, name, options->report);
 }
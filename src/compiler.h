@@ -1,17 +1,58 @@
 #ifndef __COMPILER_H_
 #define __COMPILER_H_
 
+#include "ast.h"
+#include "engine.h"
+#include "options.h"
+
+/* Default size of data segment. */
 #define DATA_SEGMENT_SIZE 30000
 
-void TearDownCompiler(void);
-void SetUpCompiler(void);
-void Compile(char*);
+/* Max size of data segment. */
+#define DATA_SEGMENT_SIZE_LIMIT (1L << 30)
+
+/* Default and max size of guarded data segment. */
+#define GUARDED_DATA_SEGMENT_SIZE (1L << 32)
+#define GUARDED_DATA_SEGMENT_SIZE_LIMIT (1L << 40)
+
+/* Min count of AST nodes to compile top level loops lazily in scripting mode. */
+#define LAZY_COMPILATION_THRESHOLD 512
+
+/* Count of cells compared at once by scan loop. */
+#define SCAN_VECTOR_WIDTH 32
+/* Max stride of vectorized scan loop. */
+#define SCAN_VECTOR_STRIDE_LIMIT 8
+
+/* Min percentage of all iterations in profile for a hot loop. */
+#define PROFILE_HOT_PERCENTAGE 1
+/* Average trip count of a loop mostly run as a condition, below it. */
+#define PROFILE_SHORT_TRIP_COUNT 2
+/* Min average trip count of a hot loop to unroll, and the unroll count. */
+#define PROFILE_LONG_TRIP_COUNT 16
+#define PROFILE_UNROLL_COUNT 8
+
+/**
+ * Compiled loop: take the data pointer at loop entry, return the data pointer at loop end.
+ */
+typedef unsigned char* (*LoopFunction)(unsigned char*);
+
+/**
+ * Compilation state of one module: loop blocks, symbols and data pointer.
+ */
+typedef struct _Compiler* Compiler;
+
+bool Compile(Engine, Options, char*);
+LoopFunction CompileLoop(Engine, Options, Ast, int, unsigned char*, char*);
 
-void WhileNotZero(void);
-void WhileEnd(void);
-void MovePointer(int);
-void UpdateValue(int);
-void InputValue(void);
-void OutputValue(void);
+void WhileNotZero(Compiler);
+void WhileEnd(Compiler);
+void MovePointer(Compiler, int);
+void UpdateValue(Compiler, int, int);
+void AssignValue(Compiler, int, int);
+void MultiplyValue(Compiler, int, int, int);
+void ScanPointer(Compiler, int);
+void InputValue(Compiler, int);
+void OutputValue(Compiler, int);
+void WriteBytes(Compiler, unsigned char*, int);
 
 #endif
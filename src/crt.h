@@ -17,6 +17,12 @@ extern unsigned int CRTN_O_LEN;
 extern unsigned char LIBC_A[];
 extern unsigned int LIBC_A_LEN;
 
+extern unsigned char RUNTIME_O[];
+extern unsigned int RUNTIME_O_LEN;
+
+extern unsigned char FREESTANDING_O[];
+extern unsigned int FREESTANDING_O_LEN;
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,90 +1,268 @@
 /**
- * Compiler engine: wrap LLVM with single module.
+ * Compiler engine: wrap LLVM with single module per engine.
  */
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+#include <llvm-c/DebugInfo.h>
+
+#include "jit.h"
 #include "engine.h"
 
-/* inner default machine. */
-static LLVMTargetMachineRef machine = NULL;
+/**
+ * Compilation context, see Engine.
+ */
+struct _Engine {
+  /* target machine of the host. */
+  LLVMTargetMachineRef machine;
+  /* context of default module, owned by the JIT with the module. */
+  LLVMContextRef context;
+  /* default module. */
+  LLVMModuleRef module;
+  /* default builder. */
+  LLVMBuilderRef builder;
+  /* JIT of the modules. */
+  JIT jit;
+  /* optimization level: 0 ~ 3. */
+  int level;
+};
+
+/* the native target is initialized once per process. */
+static pthread_once_t initialized = PTHREAD_ONCE_INIT;
 
-/* inner default module. */
-static LLVMModuleRef module = NULL;
+/**
+ * Target of the host, detected once per process with the native target; forked processes inherit it.
+ */
+static struct {
+  LLVMTargetRef target;
+  char* triple;
+  char* cpu;
+  char* features;
+} host;
 
-/* inner dfeault execution engine */
-static LLVMExecutionEngineRef engine = NULL;
+/* target machines prepared before they are required, one per optimization level, taken by the first engine. */
+static LLVMTargetMachineRef prepared[ENGINE_LEVEL_COUNT];
 
-/* inner default builder. */
-static LLVMBuilderRef builder = NULL;
+/**
+ * Code generation level of target machine for each optimization level.
+ */
+static LLVMCodeGenOptLevel CodeGenLevels[] = {
+  LLVMCodeGenLevelNone,
+  LLVMCodeGenLevelLess,
+  LLVMCodeGenLevelDefault,
+  LLVMCodeGenLevelAggressive
+};
 
 /**
- * Destroy all LLVM resources.
+ * Destroy the process-wide LLVM resources, after all engines are disposed.
  */
 void TearDownEngine(void) {
-  if (builder != NULL) {
-    LLVMDisposeBuilder(builder);
-    builder = NULL;
-  }
-  if (module != NULL) {
-    LLVMDisposeModule(module);
-    module = NULL;
-  }
-  if (machine != NULL) {
-    LLVMDisposeTargetMachine(machine);
-    machine = NULL;
+  for (int level = 0; level < ENGINE_LEVEL_COUNT; level++) {
+    if (prepared[level] != NULL) {
+      LLVMDisposeTargetMachine(prepared[level]);
+      prepared[level] = NULL;
+    }
   }
   LLVMShutdown();
 }
 
 /**
- * Initialize LLVM target machine.
+ * Register the native target, and detect the target, CPU and features of host.
  */
-void SetUpEngine() {
-  LLVMLinkInMCJIT();
+static void InitializeNativeTarget(void) {
   LLVMInitializeNativeTarget();
   LLVMInitializeNativeAsmPrinter();
   LLVMInitializeNativeAsmParser();
 
-  char* triple = LLVMGetDefaultTargetTriple();
-  LLVMTargetRef target = NULL;
+  host.triple = LLVMGetDefaultTargetTriple();
   char* message = NULL;
-  if (LLVMGetTargetFromTriple(triple, &target, &message) != 0) {
+  if (LLVMGetTargetFromTriple(host.triple, &host.target, &message) != 0) {
     fprintf(stderr, "LLVM get target from triple failed: %s\n", message);
     LLVMDisposeMessage(message);
     exit(EXIT_FAILURE);
   }
+  host.cpu = LLVMGetHostCPUName();
+  host.features = LLVMGetHostCPUFeatures();
+}
 
-  machine = LLVMCreateTargetMachine(target,
-    triple,
-    LLVMGetHostCPUName(), LLVMGetHostCPUFeatures(),
-    LLVMCodeGenLevelDefault, LLVMRelocDefault, LLVMCodeModelDefault
+/**
+ * Create target machine of the host with given optimization level.
+ */
+static LLVMTargetMachineRef CreateHostMachine(int level) {
+  return LLVMCreateTargetMachine(host.target,
+    host.triple, host.cpu, host.features,
+    CodeGenLevels[level], LLVMRelocDefault, LLVMCodeModelDefault
   );
 }
 
 /**
- * Set the default module and builder with given module name.
+ * Initialize the process-wide LLVM resources, it's safe to call from any thread.
+ */
+void SetUpEngine(void) {
+  pthread_once(&initialized, InitializeNativeTarget);
+}
+
+/**
+ * Create the target machines of all optimization levels ahead, e.g. in server before forking the workers.
+ */
+void PrepareEngines(void) {
+  SetUpEngine();
+  for (int level = 0; level < ENGINE_LEVEL_COUNT; level++) {
+    if (prepared[level] == NULL) {
+      prepared[level] = CreateHostMachine(level);
+    }
+  }
+}
+
+/**
+ * Create engine with target machine of given optimization level, the prepared one if any.
+ */
+Engine NewEngine(int level) {
+  SetUpEngine();
+  Engine engine = (Engine)calloc(sizeof(struct _Engine), 1);
+  engine->level = level;
+  // engines of batch are created concurrently, only one takes the prepared machine.
+  engine->machine = __atomic_exchange_n(&prepared[level], NULL, __ATOMIC_ACQ_REL);
+  if (engine->machine == NULL) {
+    engine->machine = CreateHostMachine(level);
+  }
+  engine->jit = NewJIT(level, host.triple, host.cpu, host.features);
+  return engine;
+}
+
+/**
+ * Destroy the engine with its module and JIT.
  */
-void SetDefaultModule(char* name) {
-  module = LLVMModuleCreateWithName(name);
-  LLVMSetSourceFileName(module, name, strlen(name));
-  LLVMSetTarget(module, LLVMGetDefaultTargetTriple());
+void DisposeEngine(Engine engine) {
+  if (engine->builder != NULL) {
+    LLVMDisposeBuilder(engine->builder);
+  }
+  if (engine->module != NULL) {
+    LLVMDisposeModule(engine->module);
+  }
+  if (engine->context != NULL) {
+    LLVMContextDispose(engine->context);
+  }
+  LLVMDisposeTargetMachine(engine->machine);
+  DisposeJIT(engine->jit);
+  free(engine);
+}
 
-  LLVMTargetDataRef layout = LLVMCreateTargetDataLayout(machine);
-  LLVMSetDataLayout(module, LLVMCopyStringRepOfTargetData(layout));
+/**
+ * Set the default module and builder with given module name, in a new context.
+ * The previous module not moved to JIT is disposed, so an engine compiles many modules one by one.
+ */
+void SetDefaultModule(Engine engine, char* name) {
+  if (engine->builder != NULL) {
+    LLVMDisposeBuilder(engine->builder);
+  }
+  if (engine->module != NULL) {
+    LLVMDisposeModule(engine->module);
+    LLVMContextDispose(engine->context);
+  }
+  engine->context = LLVMContextCreate();
+  engine->module = LLVMModuleCreateWithNameInContext(name, engine->context);
+  LLVMSetSourceFileName(engine->module, name, strlen(name));
+  LLVMSetTarget(engine->module, host.triple);
+
+  LLVMTargetDataRef layout = LLVMCreateTargetDataLayout(engine->machine);
+  char* representation = LLVMCopyStringRepOfTargetData(layout);
+  LLVMSetDataLayout(engine->module, representation);
+  LLVMDisposeMessage(representation);
   LLVMDisposeTargetData(layout);
 
-  char* message = NULL;
-  LLVMCreateJITCompilerForModule(&engine, module, 2, &message);
-  if (engine == NULL) {
-    fprintf(stderr, "Create JIT compiler failed: %s\n", message);
-    LLVMDisposeMessage(message);
+  engine->builder = LLVMCreateBuilderInContext(engine->context);
+}
+
+/**
+ * Run the new pass manager pipeline of the optimization level on the default module:
+ * mem2reg, instcombine, GVN, LICM, loop passes and vectorizers.
+ */
+void OptimizeModule(Engine engine) {
+  if (engine->level == 0) {
+    return;
+  }
+
+  char pipeline[16];
+  snprintf(pipeline, sizeof(pipeline), "default<O%d>", engine->level);
+
+  LLVMPassBuilderOptionsRef passOptions = LLVMCreatePassBuilderOptions();
+  LLVMPassBuilderOptionsSetLoopUnrolling(passOptions, true);
+  LLVMPassBuilderOptionsSetLoopInterleaving(passOptions, engine->level >= 2);
+  LLVMPassBuilderOptionsSetLoopVectorization(passOptions, engine->level >= 2);
+  LLVMPassBuilderOptionsSetSLPVectorization(passOptions, engine->level >= 2);
+
+  LLVMErrorRef error = LLVMRunPasses(engine->module, pipeline, engine->machine, passOptions);
+  LLVMDisposePassBuilderOptions(passOptions);
+  if (error != NULL) {
+    char* message = LLVMGetErrorMessage(error);
+    fprintf(stderr, "LLVM optimize module failed: %s\n", message);
+    LLVMDisposeErrorMessage(message);
     exit(EXIT_FAILURE);
   }
+}
+
+/**
+ * Count the defined functions, basic blocks and instructions of the default module.
+ */
+void CountModule(Engine engine, int* functions, int* blocks, int* instructions) {
+  *functions = *blocks = *instructions = 0;
+  for (LLVMValueRef fn = LLVMGetFirstFunction(engine->module); fn != NULL; fn = LLVMGetNextFunction(fn)) {
+    *functions += !LLVMIsDeclaration(fn);
+    for (LLVMBasicBlockRef block = LLVMGetFirstBasicBlock(fn); block != NULL; block = LLVMGetNextBasicBlock(block)) {
+      (*blocks)++;
+      for (LLVMValueRef instruction = LLVMGetFirstInstruction(block); instruction != NULL; instruction = LLVMGetNextInstruction(instruction)) {
+        (*instructions)++;
+      }
+    }
+  }
+}
+
+/* Types */
 
-  builder = LLVMCreateBuilder();
+/**
+ * Type void in the context of default module.
+ */
+LLVMTypeRef VoidType(Engine engine) {
+  return LLVMVoidTypeInContext(engine->context);
+}
+
+/**
+ * Integer type with given bits in the context of default module.
+ */
+LLVMTypeRef IntType(Engine engine, int bits) {
+  return LLVMIntTypeInContext(engine->context, bits);
+}
+
+/**
+ * Type i1 for conditions.
+ */
+LLVMTypeRef Int1Type(Engine engine) {
+  return IntType(engine, 1);
+}
+
+/**
+ * Type i8 for cells.
+ */
+LLVMTypeRef Int8Type(Engine engine) {
+  return IntType(engine, 8);
+}
+
+/**
+ * Type i32 for characters and offsets.
+ */
+LLVMTypeRef Int32Type(Engine engine) {
+  return IntType(engine, 32);
+}
+
+/**
+ * Type i64 for sizes.
+ */
+LLVMTypeRef Int64Type(Engine engine) {
+  return IntType(engine, 64);
 }
 
 /* Global Declarations */
@@ -92,48 +270,44 @@ void SetDefaultModule(char* name) {
 /**
  * Add global variable to default module.
  */
-LLVMValueRef DeclareGlobalVariable(char* name, LLVMTypeRef type) {
-  return LLVMAddGlobal(module, type, name);
+LLVMValueRef DeclareGlobalVariable(Engine engine, char* name, LLVMTypeRef type) {
+  return LLVMAddGlobal(engine->module, type, name);
 }
 
 /**
  * Add global variable with initial value to default module.
  */
-LLVMValueRef DeclareGlobalVariableWithValue(char* name, LLVMTypeRef type, LLVMValueRef value) {
-  LLVMValueRef variable = DeclareGlobalVariable(name, type);
+LLVMValueRef DeclareGlobalVariableWithValue(Engine engine, char* name, LLVMTypeRef type, LLVMValueRef value) {
+  LLVMValueRef variable = DeclareGlobalVariable(engine, name, type);
   LLVMSetInitializer(variable, value);
   return variable;
 }
 
 /**
- * Add global function to default module.
+ * Add private constant bytes to default module, return the pointer to the first byte.
  */
-LLVMValueRef DeclareFunction(char* name, LLVMTypeRef type) {
-  return LLVMAddFunction(module, name, type);
+LLVMValueRef DeclareConstantString(Engine engine, unsigned char* bytes, int length) {
+  LLVMValueRef value = LLVMConstStringInContext(engine->context, (char*)bytes, length, true);
+  LLVMValueRef variable = DeclareGlobalVariableWithValue(engine, "str", LLVMTypeOf(value), value);
+  LLVMSetLinkage(variable, LLVMPrivateLinkage);
+  LLVMSetGlobalConstant(variable, true);
+  LLVMSetUnnamedAddress(variable, LLVMGlobalUnnamedAddr);
+  return LLVMConstInBoundsGEP2(LLVMTypeOf(value), variable, (LLVMValueRef[]){ Int32(engine, 0), Int32(engine, 0) }, 2);
 }
 
 /**
- * Add external function to execution engine.
+ * Add global function to default module.
  */
-LLVMValueRef DeclareExternalFunction(char* name, LLVMTypeRef type, void* value) {
-  LLVMValueRef fn = DeclareFunction(name, type);
-  LLVMAddGlobalMapping(engine, fn, value);
-  return fn;
+LLVMValueRef DeclareFunction(Engine engine, char* name, LLVMTypeRef type) {
+  return LLVMAddFunction(engine->module, name, type);
 }
 
-/* Global Variables */
-
 /**
- * Create an integer array with given type and length, and initialized to zero.
+ * Add external function, which is resolved to the given address by JIT.
  */
-LLVMValueRef CreateZeroInitializer(LLVMTypeRef elementType, int length) {
-  LLVMTypeRef type = LLVMArrayType(elementType, length);
-  LLVMValueRef zero = LLVMConstInt(elementType, 0, false);
-  LLVMValueRef values[length];
-  for (int index = 0; index < length; index++) {
-    values[index] = zero;
-  }
-  return LLVMConstArray(elementType, values, length);
+LLVMValueRef DeclareExternalFunction(Engine engine, char* name, LLVMTypeRef type, void* value) {
+  DefineJITSymbol(engine->jit, name, value);
+  return DeclareFunction(engine, name, type);
 }
 
 /* Function Operations */
@@ -141,22 +315,38 @@ LLVMValueRef CreateZeroInitializer(LLVMTypeRef elementType, int length) {
 /**
  * Build call function.
  */
-LLVMValueRef CallFunction(LLVMTypeRef type, LLVMValueRef fn, int length, LLVMValueRef* parameters) {
-  return LLVMBuildCall2(builder, type, fn, parameters, length, "");
+LLVMValueRef CallFunction(Engine engine, LLVMTypeRef type, LLVMValueRef fn, int length, LLVMValueRef* parameters) {
+  return LLVMBuildCall2(engine->builder, type, fn, parameters, length, "");
+}
+
+/**
+ * Build call of the intrinsic function overloaded with given type.
+ */
+LLVMValueRef CallIntrinsic(Engine engine, char* name, LLVMTypeRef type, int length, LLVMValueRef* parameters) {
+  unsigned id = LLVMLookupIntrinsicID(name, strlen(name));
+  LLVMValueRef fn = LLVMGetIntrinsicDeclaration(engine->module, id, (LLVMTypeRef[]){ type }, 1);
+  return CallFunction(engine, LLVMGlobalGetValueType(fn), fn, length, parameters);
 }
 
 /**
  * Append a basic block to given function.
  */
-LLVMBasicBlockRef CreateAndAppendBlock(LLVMValueRef fn) {
-  return LLVMAppendBasicBlock(fn, "");
+LLVMBasicBlockRef CreateAndAppendBlock(Engine engine, LLVMValueRef fn) {
+  return LLVMAppendBasicBlockInContext(engine->context, fn, "");
+}
+
+/**
+ * Obtain the block at builder position.
+ */
+LLVMBasicBlockRef CurrentBlock(Engine engine) {
+  return LLVMGetInsertBlock(engine->builder);
 }
 
 /**
  * Move builder position to end of given block.
  */
-void EnterBlock(LLVMBasicBlockRef block) {
-  LLVMPositionBuilderAtEnd(builder, block);
+void EnterBlock(Engine engine, LLVMBasicBlockRef block) {
+  LLVMPositionBuilderAtEnd(engine->builder, block);
 }
 
 /* Pointer Operations */
@@ -164,29 +354,36 @@ void EnterBlock(LLVMBasicBlockRef block) {
 /**
  * Build get element pointer.
  */
-LLVMValueRef GetPointer(LLVMTypeRef type, LLVMValueRef pointer, int length, LLVMValueRef* offset) {
-  return LLVMBuildGEP2(builder, type, pointer, offset, length, "");
+LLVMValueRef GetPointer(Engine engine, LLVMTypeRef type, LLVMValueRef pointer, int length, LLVMValueRef* offset) {
+  return LLVMBuildGEP2(engine->builder, type, pointer, offset, length, "");
 }
 
 /**
  * Build allocation.
  */
-LLVMValueRef Alloc(LLVMTypeRef type) {
-  return LLVMBuildAlloca(builder, type, "");
+LLVMValueRef Alloc(Engine engine, LLVMTypeRef type) {
+  return LLVMBuildAlloca(engine->builder, type, "");
 }
 
 /**
  * Load value from the pointer.
  */
-LLVMValueRef Load(LLVMTypeRef type, LLVMValueRef pointer) {
-  return LLVMBuildLoad2(builder, type, pointer, "");
+LLVMValueRef Load(Engine engine, LLVMTypeRef type, LLVMValueRef pointer) {
+  return LLVMBuildLoad2(engine->builder, type, pointer, "");
 }
 
 /**
  * Save value to the pointer.
  */
-void Store(LLVMValueRef pointer, LLVMValueRef value) {
-  LLVMBuildStore(builder, value, pointer);
+void Store(Engine engine, LLVMValueRef pointer, LLVMValueRef value) {
+  LLVMBuildStore(engine->builder, value, pointer);
+}
+
+/**
+ * Copy bytes from source to destination.
+ */
+void CopyMemory(Engine engine, LLVMValueRef destination, LLVMValueRef source, int length) {
+  LLVMBuildMemCpy(engine->builder, destination, 1, source, 1, Int32(engine, length));
 }
 
 /* Arithmetic Operations */
@@ -194,52 +391,121 @@ void Store(LLVMValueRef pointer, LLVMValueRef value) {
 /**
  * Build plus.
  */
-LLVMValueRef Add(LLVMValueRef left, LLVMValueRef right) {
-  return LLVMBuildAdd(builder, left, right, "");
+LLVMValueRef Add(Engine engine, LLVMValueRef left, LLVMValueRef right) {
+  return LLVMBuildAdd(engine->builder, left, right, "");
 }
 
 /**
  * Build minus.
  */
-LLVMValueRef Sub(LLVMValueRef left, LLVMValueRef right) {
-  return LLVMBuildSub(builder, left, right, "");
+LLVMValueRef Sub(Engine engine, LLVMValueRef left, LLVMValueRef right) {
+  return LLVMBuildSub(engine->builder, left, right, "");
+}
+
+/**
+ * Build multiply.
+ */
+LLVMValueRef Mul(Engine engine, LLVMValueRef left, LLVMValueRef right) {
+  return LLVMBuildMul(engine->builder, left, right, "");
+}
+
+/**
+ * Build bitwise and.
+ */
+LLVMValueRef And(Engine engine, LLVMValueRef left, LLVMValueRef right) {
+  return LLVMBuildAnd(engine->builder, left, right, "");
 }
 
 /**
  * Build compare.
  */
-LLVMValueRef Compare(LLVMIntPredicate predicate, LLVMValueRef left, LLVMValueRef right) {
-  return LLVMBuildICmp(builder, predicate, left, right, "");
+LLVMValueRef Compare(Engine engine, LLVMIntPredicate predicate, LLVMValueRef left, LLVMValueRef right) {
+  return LLVMBuildICmp(engine->builder, predicate, left, right, "");
+}
+
+/**
+ * Build select: the value is `then` if condition is true, otherwise `otherwise`.
+ */
+LLVMValueRef Select(Engine engine, LLVMValueRef condition, LLVMValueRef then, LLVMValueRef otherwise) {
+  return LLVMBuildSelect(engine->builder, condition, then, otherwise, "");
 }
 
 /* Control Operations */
 
 /**
- * Build condition branch.
+ * Build condition branch, return the branch instruction.
+ */
+LLVMValueRef If(Engine engine, LLVMValueRef condition, LLVMBasicBlockRef then, LLVMBasicBlockRef otherwise) {
+  return LLVMBuildCondBr(engine->builder, condition, then, otherwise);
+}
+
+/**
+ * Attach branch weights to condition branch: the counts of taking `then` and `otherwise` recorded by profile.
+ * The counts are scaled down to 32-bit weights, and each weight is at least one like clang does.
  */
-void If(LLVMValueRef condition, LLVMBasicBlockRef then, LLVMBasicBlockRef otherwise) {
-  LLVMBuildCondBr(builder, condition, then, otherwise);
+void SetBranchWeights(Engine engine, LLVMValueRef branch, int64_t then, int64_t otherwise) {
+  int64_t scale = ((then > otherwise ? then : otherwise) >> 31) + 1;
+  LLVMMetadataRef operands[] = {
+    LLVMMDStringInContext2(engine->context, "branch_weights", strlen("branch_weights")),
+    LLVMValueAsMetadata(Int32(engine, then / scale + 1)),
+    LLVMValueAsMetadata(Int32(engine, otherwise / scale + 1))
+  };
+  LLVMMetadataRef weights = LLVMMDNodeInContext2(engine->context, operands, 3);
+  LLVMSetMetadata(branch, LLVMGetMDKindIDInContext(engine->context, "prof", strlen("prof")), LLVMMetadataAsValue(engine->context, weights));
 }
 
 /**
- * Build branch.
+ * Build loop hint of metadata `!{!"name", i32 value}`.
  */
-void Goto(LLVMBasicBlockRef label) {
-  LLVMBuildBr(builder, label);
+static LLVMMetadataRef LoopHint(Engine engine, char* name, int value) {
+  LLVMMetadataRef operands[] = {
+    LLVMMDStringInContext2(engine->context, name, strlen(name)),
+    LLVMValueAsMetadata(Int32(engine, value))
+  };
+  return LLVMMDNodeInContext2(engine->context, operands, 2);
+}
+
+/**
+ * Attach loop hints to the latch branch of loop: unroll count, 1 disables unrolling and 0 leaves it to LLVM;
+ * vectorization is disabled if not allowed.
+ * The loop metadata refers to itself, which is made distinct by replacing a temporary node.
+ */
+void SetLoopHints(Engine engine, LLVMValueRef latch, int unroll, bool vectorize) {
+  LLVMMetadataRef operands[3];
+  int count = 0;
+  operands[count++] = LLVMTemporaryMDNode(engine->context, NULL, 0);
+  if (unroll == 1) {
+    operands[count++] = LLVMMDNodeInContext2(engine->context, (LLVMMetadataRef[]){ LLVMMDStringInContext2(engine->context, "llvm.loop.unroll.disable", strlen("llvm.loop.unroll.disable")) }, 1);
+  } else if (unroll > 1) {
+    operands[count++] = LoopHint(engine, "llvm.loop.unroll.count", unroll);
+  }
+  if (!vectorize) {
+    operands[count++] = LoopHint(engine, "llvm.loop.vectorize.width", 1);
+  }
+  LLVMMetadataRef loop = LLVMMDNodeInContext2(engine->context, operands, count);
+  LLVMMetadataReplaceAllUsesWith(operands[0], loop);
+  LLVMSetMetadata(latch, LLVMGetMDKindIDInContext(engine->context, "llvm.loop", strlen("llvm.loop")), LLVMMetadataAsValue(engine->context, loop));
+}
+
+/**
+ * Build branch, return the branch instruction.
+ */
+LLVMValueRef Goto(Engine engine, LLVMBasicBlockRef label) {
+  return LLVMBuildBr(engine->builder, label);
 }
 
 /**
  * Build return a value.
  */
-void Return(LLVMValueRef value) {
-  LLVMBuildRet(builder, value);
+void Return(Engine engine, LLVMValueRef value) {
+  LLVMBuildRet(engine->builder, value);
 }
 
 /**
  * Build return void.
  */
-void ReturnVoid() {
-  LLVMBuildRetVoid(builder);
+void ReturnVoid(Engine engine) {
+  LLVMBuildRetVoid(engine->builder);
 }
 
 /* Conversion Operations */
@@ -247,15 +513,29 @@ void ReturnVoid() {
 /**
  * Sign extends type.
  */
-LLVMValueRef ExtendType(LLVMValueRef value, LLVMTypeRef type) {
-  return LLVMBuildSExt(builder, value, type, "");
+LLVMValueRef ExtendType(Engine engine, LLVMValueRef value, LLVMTypeRef type) {
+  return LLVMBuildSExt(engine->builder, value, type, "");
 }
 
 /**
  * Truncate type.
  */
-LLVMValueRef TruncateType(LLVMValueRef value, LLVMTypeRef type) {
-  return LLVMBuildTrunc(builder, value, type, "");
+LLVMValueRef TruncateType(Engine engine, LLVMValueRef value, LLVMTypeRef type) {
+  return LLVMBuildTrunc(engine->builder, value, type, "");
+}
+
+/**
+ * Reinterpret bits as another type with same size.
+ */
+LLVMValueRef CastType(Engine engine, LLVMValueRef value, LLVMTypeRef type) {
+  return LLVMBuildBitCast(engine->builder, value, type, "");
+}
+
+/**
+ * Cast pointer to another pointer type.
+ */
+LLVMValueRef CastPointer(Engine engine, LLVMValueRef pointer, LLVMTypeRef type) {
+  return LLVMBuildPointerCast(engine->builder, pointer, type, "");
 }
 
 /* Output */
@@ -263,8 +543,8 @@ LLVMValueRef TruncateType(LLVMValueRef value, LLVMTypeRef type) {
 /**
  * Emit LLVM IR for the module to file or standard output if filename is NULL.
  */
-void EmitIntermediateRepresentation(char* filename) {
-  char* ir = LLVMPrintModuleToString(module);
+void EmitIntermediateRepresentation(Engine engine, char* filename) {
+  char* ir = LLVMPrintModuleToString(engine->module);
   if (filename == NULL) {
     printf("%s", ir);
   } else {
@@ -281,9 +561,9 @@ void EmitIntermediateRepresentation(char* filename) {
 /**
  * Emit object file for the module to given filename.
  */
-void EmitObjectFile(char* filename) {
+void EmitObjectFile(Engine engine, char* filename) {
   char* message = NULL;
-  if (LLVMTargetMachineEmitToFile(machine, module, filename, LLVMObjectFile, &message) != 0) {
+  if (LLVMTargetMachineEmitToFile(engine->machine, engine->module, filename, LLVMObjectFile, &message) != 0) {
     fprintf(stderr, "LLVM emit object file failed: %s\n", message);
     LLVMDisposeMessage(message);
     exit(EXIT_FAILURE);
@@ -291,9 +571,50 @@ void EmitObjectFile(char* filename) {
 }
 
 /**
- * Run machine code of main function with MCJIT execution engine.
+ * Emit object code for the module to a memory buffer, which is owned by the caller.
  */
-void ExecuteMachineCode() {
-  int (*fn)(void) = (int(*)(void))LLVMGetFunctionAddress(engine, "main");
+LLVMMemoryBufferRef EmitObjectBuffer(Engine engine) {
+  char* message = NULL;
+  LLVMMemoryBufferRef buffer = NULL;
+  if (LLVMTargetMachineEmitToMemoryBuffer(engine->machine, engine->module, LLVMObjectFile, &message, &buffer) != 0) {
+    fprintf(stderr, "LLVM emit object buffer failed: %s\n", message);
+    LLVMDisposeMessage(message);
+    exit(EXIT_FAILURE);
+  }
+  return buffer;
+}
+
+/**
+ * Move the default module with its context to the JIT of engine, compile each function at its first call if lazy.
+ * The JIT is set up for the first module, with machine code cache if required.
+ */
+static void AddModuleToJIT(Engine engine, bool lazy, bool cached, Report report) {
+  LLVMDisposeBuilder(engine->builder);
+  engine->builder = NULL;
+  AddJITModule(engine->jit, engine->module, lazy, cached, report);
+  engine->module = NULL;
+  engine->context = NULL;
+}
+
+/**
+ * Generate machine code of the default module with JIT, return the address of function.
+ */
+void* GetMachineCode(Engine engine, char* name, Report report) {
+  AddModuleToJIT(engine, false, false, report);
+  return LookupJITSymbol(engine->jit, name);
+}
+
+/**
+ * Run main function of the default module with JIT, load and store machine code in cache if required.
+ * Lazy compilation only pays off if main calls the other functions defined in the module.
+ * The time of compiling on JIT compile threads is added to the jit phase of report.
+ */
+void ExecuteMachineCode(Engine engine, int cached, Report report) {
+  int functions = 0;
+  for (LLVMValueRef fn = LLVMGetFirstFunction(engine->module); fn != NULL; fn = LLVMGetNextFunction(fn)) {
+    functions += !LLVMIsDeclaration(fn);
+  }
+  AddModuleToJIT(engine, functions > 1, cached, report);
+  int (*fn)(void) = (int(*)(void))LookupJITSymbol(engine->jit, "main");
   fn();
 }
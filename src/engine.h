@@ -1,56 +1,94 @@
 #ifndef __ENGINE_H_
 #define __ENGINE_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <llvm-c/Core.h>
 #include <llvm-c/Target.h>
 #include <llvm-c/TargetMachine.h>
-#include <llvm-c/ExecutionEngine.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+
+#include "report.h"
 
 #define EMPTY_SPACE 0
-#define Int8PointerType LLVMPointerType(LLVMInt8Type(), EMPTY_SPACE)
 
-#define Int32(n) LLVMConstInt(LLVMInt32Type(), (n), false)
-#define Int8(n) LLVMConstInt(LLVMInt8Type(), (n), false)
+/* Count of optimization levels: 0 ~ 3. */
+#define ENGINE_LEVEL_COUNT 4
+#define Int8PointerType(e) LLVMPointerType(Int8Type(e), EMPTY_SPACE)
+
+#define Int64(e, n) LLVMConstInt(Int64Type(e), (n), false)
+#define Int32(e, n) LLVMConstInt(Int32Type(e), (n), false)
+#define Int8(e, n) LLVMConstInt(Int8Type(e), (n), false)
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Compilation context: target machine, module with its own LLVM context, builder and JIT.
+ * Engines share nothing, each thread may compile with its own engine.
+ */
+typedef struct _Engine* Engine;
+
 void TearDownEngine(void);
-void SetUpEngine();
-void SetDefaultModule(char*);
+void SetUpEngine(void);
+void PrepareEngines(void);
+Engine NewEngine(int);
+void DisposeEngine(Engine);
+void SetDefaultModule(Engine, char*);
+void OptimizeModule(Engine);
+void CountModule(Engine, int*, int*, int*);
 
-LLVMValueRef DeclareGlobalVariable(char*, LLVMTypeRef);
-LLVMValueRef DeclareGlobalVariableWithValue(char*, LLVMTypeRef, LLVMValueRef);
-LLVMValueRef DeclareFunction(char*, LLVMTypeRef);
-LLVMValueRef DeclareExternalFunction(char*, LLVMTypeRef, void*);
+LLVMTypeRef VoidType(Engine);
+LLVMTypeRef IntType(Engine, int);
+LLVMTypeRef Int1Type(Engine);
+LLVMTypeRef Int8Type(Engine);
+LLVMTypeRef Int32Type(Engine);
+LLVMTypeRef Int64Type(Engine);
 
-LLVMValueRef CreateZeroInitializer(LLVMTypeRef, int);
+LLVMValueRef DeclareGlobalVariable(Engine, char*, LLVMTypeRef);
+LLVMValueRef DeclareGlobalVariableWithValue(Engine, char*, LLVMTypeRef, LLVMValueRef);
+LLVMValueRef DeclareConstantString(Engine, unsigned char*, int);
+LLVMValueRef DeclareFunction(Engine, char*, LLVMTypeRef);
+LLVMValueRef DeclareExternalFunction(Engine, char*, LLVMTypeRef, void*);
 
-LLVMValueRef CallFunction(LLVMTypeRef, LLVMValueRef, int, LLVMValueRef*);
-LLVMBasicBlockRef CreateAndAppendBlock(LLVMValueRef);
-void EnterBlock(LLVMBasicBlockRef);
+LLVMValueRef CallFunction(Engine, LLVMTypeRef, LLVMValueRef, int, LLVMValueRef*);
+LLVMValueRef CallIntrinsic(Engine, char*, LLVMTypeRef, int, LLVMValueRef*);
+LLVMBasicBlockRef CreateAndAppendBlock(Engine, LLVMValueRef);
+LLVMBasicBlockRef CurrentBlock(Engine);
+void EnterBlock(Engine, LLVMBasicBlockRef);
 
-LLVMValueRef GetPointer(LLVMTypeRef, LLVMValueRef, int, LLVMValueRef*);
-LLVMValueRef Alloc(LLVMTypeRef);
-LLVMValueRef Load(LLVMTypeRef, LLVMValueRef);
-void Store(LLVMValueRef, LLVMValueRef);
+LLVMValueRef GetPointer(Engine, LLVMTypeRef, LLVMValueRef, int, LLVMValueRef*);
+LLVMValueRef Alloc(Engine, LLVMTypeRef);
+LLVMValueRef Load(Engine, LLVMTypeRef, LLVMValueRef);
+void Store(Engine, LLVMValueRef, LLVMValueRef);
+void CopyMemory(Engine, LLVMValueRef, LLVMValueRef, int);
 
-LLVMValueRef Add(LLVMValueRef, LLVMValueRef);
-LLVMValueRef Sub(LLVMValueRef, LLVMValueRef);
-LLVMValueRef Compare(LLVMIntPredicate, LLVMValueRef, LLVMValueRef);
+LLVMValueRef Add(Engine, LLVMValueRef, LLVMValueRef);
+LLVMValueRef Sub(Engine, LLVMValueRef, LLVMValueRef);
+LLVMValueRef Mul(Engine, LLVMValueRef, LLVMValueRef);
+LLVMValueRef And(Engine, LLVMValueRef, LLVMValueRef);
+LLVMValueRef Compare(Engine, LLVMIntPredicate, LLVMValueRef, LLVMValueRef);
+LLVMValueRef Select(Engine, LLVMValueRef, LLVMValueRef, LLVMValueRef);
 
-void If(LLVMValueRef, LLVMBasicBlockRef, LLVMBasicBlockRef);
-void Goto(LLVMBasicBlockRef);
-void Return(LLVMValueRef);
-void ReturnVoid();
+LLVMValueRef If(Engine, LLVMValueRef, LLVMBasicBlockRef, LLVMBasicBlockRef);
+void SetBranchWeights(Engine, LLVMValueRef, int64_t, int64_t);
+void SetLoopHints(Engine, LLVMValueRef, int, bool);
+LLVMValueRef Goto(Engine, LLVMBasicBlockRef);
+void Return(Engine, LLVMValueRef);
+void ReturnVoid(Engine);
 
-LLVMValueRef ExtendType(LLVMValueRef, LLVMTypeRef);
-LLVMValueRef TruncateType(LLVMValueRef, LLVMTypeRef);
+LLVMValueRef ExtendType(Engine, LLVMValueRef, LLVMTypeRef);
+LLVMValueRef TruncateType(Engine, LLVMValueRef, LLVMTypeRef);
+LLVMValueRef CastType(Engine, LLVMValueRef, LLVMTypeRef);
+LLVMValueRef CastPointer(Engine, LLVMValueRef, LLVMTypeRef);
 
-void EmitIntermediateRepresentation(char*);
-void EmitObjectFile(char*);
-void ExecuteMachineCode(void);
+void EmitIntermediateRepresentation(Engine, char*);
+void EmitObjectFile(Engine, char*);
+LLVMMemoryBufferRef EmitObjectBuffer(Engine);
+void* GetMachineCode(Engine, char*, Report);
+void ExecuteMachineCode(Engine, int, Report);
 
 #ifdef __cplusplus
 }
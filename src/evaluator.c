@@ -0,0 +1,250 @@
+/**
+ * Partial evaluator: run the input-independent prefix of program at compile time.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "evaluator.h"
+
+/**
+ * Evaluation state of one call, with journal to rollback the unfinished node.
+ */
+typedef struct _Evaluator {
+  unsigned char* tape;
+  int size;
+  int position;
+  long budget;
+
+  unsigned char* output;
+  int length;
+  int capacity;
+
+  /* node serial number of the last journaled write of each cell. */
+  int* stamps;
+  int stamp;
+  struct {
+    int index;
+    unsigned char value;
+  }* journal;
+  int entries;
+  int journalCapacity;
+} *Evaluator;
+
+/**
+ * Return the index after the top level node at the index, the whole loop for block node.
+ */
+static int NodeEnd(Ast ast, int index) {
+  Node node = &ast->nodes[index];
+  return node->type == BlockNode ? node->jump + 1 : index + 1;
+}
+
+/**
+ * Return if any node in the range reads input.
+ */
+static bool ReadsInput(Ast ast, int begin, int end) {
+  for (int index = begin; index < end; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == InstructionNode && node->instruction.symbol == InputInstruction) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Return the index of cell, or -1 if out of the tape.
+ */
+static int CellIndex(Evaluator evaluator, int offset) {
+  int index = evaluator->position + offset;
+  return index >= 0 && index < evaluator->size ? index : -1;
+}
+
+/**
+ * Write cell, record its original value in journal at the first write.
+ */
+static void WriteCell(Evaluator evaluator, int index, int value) {
+  if (evaluator->stamps[index] != evaluator->stamp) {
+    if (evaluator->entries == evaluator->journalCapacity) {
+      evaluator->journalCapacity = evaluator->journalCapacity * 2 + 1024;
+      evaluator->journal = realloc(evaluator->journal, sizeof(*evaluator->journal) * evaluator->journalCapacity);
+    }
+    evaluator->stamps[index] = evaluator->stamp;
+    evaluator->journal[evaluator->entries].index = index;
+    evaluator->journal[evaluator->entries].value = evaluator->tape[index];
+    evaluator->entries++;
+  }
+  evaluator->tape[index] = value;
+}
+
+/**
+ * Append bytes to output.
+ */
+static void AppendOutput(Evaluator evaluator, unsigned char* bytes, int length) {
+  if (evaluator->length + length > evaluator->capacity) {
+    evaluator->capacity = (evaluator->length + length) * 2;
+    evaluator->output = (unsigned char*)realloc(evaluator->output, evaluator->capacity);
+  }
+  memcpy(evaluator->output + evaluator->length, bytes, length);
+  evaluator->length += length;
+}
+
+/**
+ * Execute one instruction, return false if it accesses cell out of the tape.
+ */
+static bool ExecuteInstruction(Evaluator evaluator, Instruction instruction) {
+  int index = instruction->symbol == MoveInstruction
+      || instruction->symbol == WriteInstruction
+      ? 0 : CellIndex(evaluator, instruction->offset);
+  if (index < 0) {
+    return false;
+  }
+
+  switch (instruction->symbol) {
+  case UpdateInstruction:
+    WriteCell(evaluator, index, evaluator->tape[index] + instruction->parameter);
+    break;
+  case SetInstruction:
+    WriteCell(evaluator, index, instruction->parameter);
+    break;
+  case MultiplyInstruction: {
+    if (evaluator->tape[index] == 0) {
+      break;
+    }
+    int target = CellIndex(evaluator, instruction->offset + instruction->target);
+    if (target < 0) {
+      return false;
+    }
+    WriteCell(evaluator, target, evaluator->tape[target] + evaluator->tape[index] * instruction->parameter);
+    break;
+  }
+  case MoveInstruction:
+    evaluator->position += instruction->parameter;
+    break;
+  case ScanInstruction:
+    while (evaluator->tape[index] != 0) {
+      evaluator->position += instruction->parameter;
+      index = CellIndex(evaluator, 0);
+      if (index < 0 || --evaluator->budget < 0) {
+        return false;
+      }
+    }
+    break;
+  case OutputInstruction:
+    AppendOutput(evaluator, evaluator->tape + index, 1);
+    break;
+  case WriteInstruction:
+    AppendOutput(evaluator, instruction->bytes, instruction->parameter);
+    break;
+  default:
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Execute the nodes in the range, return false if the budget is exhausted or it accesses cell out of the tape.
+ */
+static bool ExecuteNodes(Evaluator evaluator, Ast ast, int begin, int end) {
+  for (int pc = begin; pc < end; pc++) {
+    if (--evaluator->budget < 0) {
+      return false;
+    }
+    Node node = &ast->nodes[pc];
+    if (node->type == InstructionNode) {
+      if (!ExecuteInstruction(evaluator, &node->instruction)) {
+        return false;
+      }
+    } else {
+      int index = CellIndex(evaluator, 0);
+      if (index < 0) {
+        return false;
+      }
+      // loop begin: jump over the end if zero; loop end: jump back to body if not zero.
+      bool begin = node->type == BlockNode;
+      if ((evaluator->tape[index] == 0) == begin) {
+        pc = node->jump;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Partial evaluation: execute the top level nodes on the tape until the first node reading input,
+ * or the step budget is exhausted.
+ * The evaluated nodes are replaced in place by writing the pending output and moving the data pointer.
+ */
+Ast EvaluateAst(Ast ast, unsigned char* tape, int size, long budget) {
+  struct _Evaluator state;
+  Evaluator evaluator = &state;
+  evaluator->tape = tape;
+  evaluator->size = size;
+  evaluator->position = 0;
+  evaluator->budget = budget;
+  evaluator->output = NULL;
+  evaluator->length = 0;
+  evaluator->capacity = 0;
+  evaluator->stamps = (int*)calloc(sizeof(int), size);
+  evaluator->stamp = 0;
+  evaluator->journal = NULL;
+  evaluator->journalCapacity = 0;
+
+  int index = 0;
+  while (index < ast->count) {
+    int end = NodeEnd(ast, index);
+    if (ReadsInput(ast, index, end)) {
+      break;
+    }
+    int position = evaluator->position;
+    int length = evaluator->length;
+    evaluator->stamp++;
+    evaluator->entries = 0;
+    if (!ExecuteNodes(evaluator, ast, index, end)) {
+      // rollback
+      while (evaluator->entries > 0) {
+        evaluator->entries--;
+        tape[evaluator->journal[evaluator->entries].index] = evaluator->journal[evaluator->entries].value;
+      }
+      evaluator->position = position;
+      evaluator->length = length;
+      break;
+    }
+    index = end;
+  }
+
+  // rest program: the pending output and moving, then the nodes not evaluated.
+  int head = (evaluator->length > 0) + (evaluator->position != 0);
+  int rest = ast->count - index;
+  for (int slot = 0; slot < head; slot++) {
+    AppendNode(ast, InstructionNode);
+  }
+  memmove(&ast->nodes[head], &ast->nodes[index], sizeof(struct _Node) * rest);
+  ast->count = head + rest;
+  for (int slot = head; slot < ast->count; slot++) {
+    if (ast->nodes[slot].type != InstructionNode) {
+      ast->nodes[slot].jump += head - index;
+    }
+  }
+
+  head = 0;
+  if (evaluator->length > 0) {
+    Node node = &ast->nodes[head++];
+    memset(node, 0, sizeof(struct _Node));
+    node->instruction.symbol = WriteInstruction;
+    node->instruction.parameter = evaluator->length;
+    node->instruction.bytes = AllocateBytes(ast, evaluator->length);
+    memcpy(node->instruction.bytes, evaluator->output, evaluator->length);
+  }
+  if (evaluator->position != 0) {
+    Node node = &ast->nodes[head++];
+    memset(node, 0, sizeof(struct _Node));
+    node->instruction.symbol = MoveInstruction;
+    node->instruction.parameter = evaluator->position;
+  }
+
+  free(evaluator->output);
+  free(evaluator->journal);
+  free(evaluator->stamps);
+  return ast;
+}
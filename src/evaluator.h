@@ -0,0 +1,14 @@
+#ifndef __EVALUATOR_H_
+#define __EVALUATOR_H_
+
+#include "ast.h"
+
+/* Max count of instructions executed by partial evaluation. */
+#define EVALUATION_STEP_LIMIT 10000000
+
+/* Max size of tape for partial evaluation. */
+#define EVALUATION_TAPE_LIMIT (64 * 1024 * 1024)
+
+Ast EvaluateAst(Ast, unsigned char*, int, long);
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * Freestanding runtime: process startup and the few C library functions used by runtime and generated code,
+ * with raw Linux system calls.
+ *
+ * It's linked into executable files instead of libc, it has no initialization but reading the page size.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* Type of auxiliary vector entry for page size, see <elf.h>. */
+#define AUXILIARY_PAGE_SIZE 6
+
+/* Flag of kernel sigaction: the restorer is set. */
+#define KERNEL_SA_RESTORER 0x04000000
+
+int main(void);
+
+/* Error number of the last failed system call. */
+static int error = 0;
+
+/* Page size from auxiliary vector. */
+static long pageSize = 4096;
+
+/**
+ * Kernel version of struct sigaction, with signal mask of 64 signals.
+ */
+struct KernelSigaction {
+  void* handler;
+  unsigned long flags;
+  void (*restorer)(void);
+  unsigned long mask;
+};
+
+/* System Calls */
+
+#if defined(__x86_64__)
+
+static long SystemCall(long number, long a, long b, long c, long d, long e, long f) {
+  register long r10 __asm__("r10") = d;
+  register long r8 __asm__("r8") = e;
+  register long r9 __asm__("r9") = f;
+  long result;
+  __asm__ volatile ("syscall"
+    : "=a"(result)
+    : "a"(number), "D"(a), "S"(b), "d"(c), "r"(r10), "r"(r8), "r"(r9)
+    : "rcx", "r11", "memory");
+  return result;
+}
+
+/**
+ * Entry point: pass the initial stack to Start with aligned stack.
+ */
+__asm__(
+  ".text\n"
+  ".global _start\n"
+  "_start:\n"
+  "  xor %rbp, %rbp\n"
+  "  mov %rsp, %rdi\n"
+  "  and $-16, %rsp\n"
+  "  call Start\n"
+  "  hlt\n"
+);
+
+/**
+ * Return from signal handler, x86_64 requires the restorer from user space.
+ */
+__asm__(
+  ".text\n"
+  ".hidden RestoreSignal\n"
+  "RestoreSignal:\n"
+  "  mov $15, %rax\n"
+  "  syscall\n"
+);
+
+void RestoreSignal(void);
+
+#define SIGNAL_RESTORER_FLAG KERNEL_SA_RESTORER
+
+#elif defined(__aarch64__)
+
+static long SystemCall(long number, long a, long b, long c, long d, long e, long f) {
+  register long x8 __asm__("x8") = number;
+  register long x0 __asm__("x0") = a;
+  register long x1 __asm__("x1") = b;
+  register long x2 __asm__("x2") = c;
+  register long x3 __asm__("x3") = d;
+  register long x4 __asm__("x4") = e;
+  register long x5 __asm__("x5") = f;
+  __asm__ volatile ("svc 0"
+    : "+r"(x0)
+    : "r"(x8), "r"(x1), "r"(x2), "r"(x3), "r"(x4), "r"(x5)
+    : "memory");
+  return x0;
+}
+
+/**
+ * Entry point: pass the initial stack to Start with aligned stack.
+ */
+__asm__(
+  ".text\n"
+  ".global _start\n"
+  "_start:\n"
+  "  mov x29, #0\n"
+  "  mov x30, #0\n"
+  "  mov x0, sp\n"
+  "  and x1, x0, #-16\n"
+  "  mov sp, x1\n"
+  "  bl Start\n"
+  "  brk #0\n"
+);
+
+/* The kernel returns from signal handler with the trampoline of vDSO. */
+#define RestoreSignal NULL
+#define SIGNAL_RESTORER_FLAG 0
+
+#else
+#error "Freestanding runtime supports x86_64 and aarch64 only."
+#endif
+
+/**
+ * Return the result of system call, or set error number and return -1 if failed.
+ */
+static long CheckSystemCall(long result) {
+  if (result < 0 && result > -4096) {
+    error = -result;
+    return -1;
+  }
+  return result;
+}
+
+/**
+ * Find the page size in auxiliary vector after arguments and environment variables,
+ * run main and exit with its result.
+ */
+__attribute__((used, noreturn)) void Start(long* stack) {
+  long count = stack[0];
+  long* environment = stack + count + 2;
+  while (*environment != 0) {
+    environment++;
+  }
+  for (long* auxiliary = environment + 1; auxiliary[0] != 0; auxiliary += 2) {
+    if (auxiliary[0] == AUXILIARY_PAGE_SIZE) {
+      pageSize = auxiliary[1];
+    }
+  }
+  _exit(main());
+}
+
+/* System Functions */
+
+int* __errno_location(void) {
+  return &error;
+}
+
+void _exit(int status) {
+  while (1) {
+    SystemCall(SYS_exit_group, status, 0, 0, 0, 0, 0);
+  }
+}
+
+ssize_t read(int fd, void* buffer, size_t length) {
+  return CheckSystemCall(SystemCall(SYS_read, fd, (long)buffer, length, 0, 0, 0));
+}
+
+ssize_t write(int fd, const void* buffer, size_t length) {
+  return CheckSystemCall(SystemCall(SYS_write, fd, (long)buffer, length, 0, 0, 0));
+}
+
+/**
+ * Open file relative to the working directory, the mode is given only when the file may be created.
+ */
+int open(const char* path, int flags, ...) {
+  mode_t mode = 0;
+  if (flags & O_CREAT) {
+    va_list arguments;
+    va_start(arguments, flags);
+    mode = va_arg(arguments, mode_t);
+    va_end(arguments);
+  }
+  return CheckSystemCall(SystemCall(SYS_openat, AT_FDCWD, (long)path, flags, mode, 0, 0));
+}
+
+int close(int fd) {
+  return CheckSystemCall(SystemCall(SYS_close, fd, 0, 0, 0, 0, 0));
+}
+
+long sysconf(int name) {
+  return name == _SC_PAGESIZE ? pageSize : -1;
+}
+
+void* mmap(void* address, size_t length, int protection, int flags, int fd, off_t offset) {
+  return (void*)CheckSystemCall(SystemCall(SYS_mmap, (long)address, length, protection, flags, fd, offset));
+}
+
+int mprotect(void* address, size_t length, int protection) {
+  return CheckSystemCall(SystemCall(SYS_mprotect, (long)address, length, protection, 0, 0, 0));
+}
+
+int sigaltstack(const stack_t* stack, stack_t* old) {
+  return CheckSystemCall(SystemCall(SYS_sigaltstack, (long)stack, (long)old, 0, 0, 0, 0));
+}
+
+int sigemptyset(sigset_t* set) {
+  memset(set, 0, sizeof(sigset_t));
+  return 0;
+}
+
+/**
+ * Set signal action with the kernel layout, only the first 64 signals of mask are used.
+ */
+int sigaction(int signal, const struct sigaction* action, struct sigaction* old) {
+  struct KernelSigaction kernel;
+  memset(&kernel, 0, sizeof(kernel));
+  kernel.handler = action->sa_flags & SA_SIGINFO ? (void*)action->sa_sigaction : (void*)action->sa_handler;
+  kernel.flags = action->sa_flags | SIGNAL_RESTORER_FLAG;
+  kernel.restorer = RestoreSignal;
+  memcpy(&kernel.mask, &action->sa_mask, sizeof(kernel.mask));
+  // the old action is never used by runtime.
+  return CheckSystemCall(SystemCall(SYS_rt_sigaction, signal, (long)&kernel, 0, sizeof(kernel.mask), 0, 0));
+}
+
+/* Memory Functions: generated code may call them for memory intrinsics. */
+
+void* memcpy(void* target, const void* source, size_t length) {
+  unsigned char* to = (unsigned char*)target;
+  const unsigned char* from = (const unsigned char*)source;
+  while (length-- > 0) {
+    *to++ = *from++;
+  }
+  return target;
+}
+
+void* memmove(void* target, const void* source, size_t length) {
+  unsigned char* to = (unsigned char*)target;
+  const unsigned char* from = (const unsigned char*)source;
+  if (to < from) {
+    while (length-- > 0) {
+      *to++ = *from++;
+    }
+  } else {
+    while (length-- > 0) {
+      to[length] = from[length];
+    }
+  }
+  return target;
+}
+
+void* memset(void* target, int value, size_t length) {
+  unsigned char* to = (unsigned char*)target;
+  while (length-- > 0) {
+    *to++ = (unsigned char)value;
+  }
+  return target;
+}
+
+void* memchr(const void* source, int value, size_t length) {
+  const unsigned char* from = (const unsigned char*)source;
+  for (; length > 0; length--, from++) {
+    if (*from == (unsigned char)value) {
+      return (void*)from;
+    }
+  }
+  return NULL;
+}
+
+size_t strlen(const char* text) {
+  const char* end = text;
+  while (*end != '\0') {
+    end++;
+  }
+  return end - text;
+}
@@ -1,28 +1,44 @@
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
-#include <llvm/Support/FileSystem.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "fs.h"
 
 /**
- * Get a unique temporary file name, not currently exisiting in the filesystem,
- * and allocate spaces to store the name.
+ * Create an anonymous file in memory with the content,
+ * return its path under /proc/self/fd, or NULL if failed.
+ * The file is never written to disk, and is gone when it is closed.
  */
-char* CreateTemporaryFileName() {
-  llvm::SmallString<128> buffer;
-  llvm::sys::fs::getPotentiallyUniqueTempFileName("", "", buffer);
-  char* path = (char*)calloc(buffer.size() + 1, sizeof(char));
-  strcpy(path, buffer.c_str());
+char* CreateMemoryFile(const char* name, const void* content, unsigned long length) {
+  int fd = memfd_create(name, MFD_CLOEXEC);
+  if (fd < 0) {
+    return NULL;
+  }
+  const char* bytes = (const char*)content;
+  while (length > 0) {
+    ssize_t written = write(fd, bytes, length);
+    if (written <= 0) {
+      close(fd);
+      return NULL;
+    }
+    bytes += written;
+    length -= written;
+  }
+
+  char* path = (char*)calloc(32, sizeof(char));
+  snprintf(path, 32, "/proc/self/fd/%d", fd);
   return path;
 }
 
 /**
- * Delete the file and free the path spaces.
+ * Close the memory file and free the path spaces.
  */
-void DeleteTemporaryFile(char* path) {
+void DeleteMemoryFile(char* path) {
   if (path != NULL) {
-    llvm::sys::fs::remove(path);
+    close(atoi(strrchr(path, '/') + 1));
     free(path);
   }
 }
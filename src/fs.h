@@ -5,8 +5,8 @@
 extern "C" {
 #endif
 
-  char* CreateTemporaryFileName();
-  void DeleteTemporaryFile(char*);
+  char* CreateMemoryFile(const char*, const void*, unsigned long);
+  void DeleteMemoryFile(char*);
 
   #ifdef __cplusplus
 }
@@ -0,0 +1,320 @@
+/**
+ * Bytecode interpreter: run the optimized AST with threaded dispatch, without LLVM.
+ * In tiered mode, hot loops are compiled in background and called at the next loop entry.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "options.h"
+#include "parser.h"
+#include "runtime.h"
+#include "engine.h"
+#include "compiler.h"
+#include "interpreter.h"
+
+/**
+ * Loop of tiered mode: the back edge counter and the compiled function.
+ */
+typedef struct _Loop {
+  /* index of the block node in AST. */
+  int node;
+  int serial;
+  int count;
+  _Atomic(LoopFunction) function;
+  struct _Loop* next;
+} *Loop;
+
+/**
+ * Background compiler of hot loops: the queue is guarded by mutex.
+ */
+static struct {
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t ready;
+  bool started;
+  bool stopped;
+  Loop head;
+  Loop tail;
+  Ast ast;
+  unsigned char* tape;
+} tier = { .mutex = PTHREAD_MUTEX_INITIALIZER, .ready = PTHREAD_COND_INITIALIZER };
+
+/**
+ * Lower AST to bytecode ended with halt, one operation for each node; the constant bytes are shared with AST.
+ */
+Bytecode LowerAst(Ast ast) {
+  Bytecode code = (Bytecode)calloc(sizeof(struct _Bytecode), ast->count + 1);
+  int loops = 0;
+  for (int index = 0; index < ast->count; index++) {
+    Node node = &ast->nodes[index];
+    if (node->type == BlockNode) {
+      code[index].opcode = LoopBeginOpcode;
+      code[index].parameter = node->jump + 1;
+      code[index].target = loops++;
+    } else if (node->type == BlockEndNode) {
+      code[index].opcode = LoopEndOpcode;
+      code[index].parameter = node->jump + 1;
+      code[index].target = code[node->jump].target;
+    } else {
+      Instruction instruction = &node->instruction;
+      code[index].opcode = (Opcode)instruction->symbol;
+      code[index].parameter = instruction->parameter;
+      code[index].offset = instruction->offset;
+      code[index].target = instruction->target;
+      code[index].bytes = instruction->bytes;
+    }
+  }
+  code[ast->count].opcode = HaltOpcode;
+  return code;
+}
+
+/* Tiers */
+
+/**
+ * Background thread: compile the queued hot loops one by one until stopped.
+ * LLVM is only set up and used in this thread.
+ */
+static void* CompileHotLoops(void* argument) {
+  SetUpEngine();
+  Engine engine = NewEngine(options.optimizationLevel);
+  pthread_mutex_lock(&tier.mutex);
+  while (true) {
+    while (tier.head == NULL && !tier.stopped) {
+      pthread_cond_wait(&tier.ready, &tier.mutex);
+    }
+    if (tier.stopped) {
+      break;
+    }
+    Loop loop = tier.head;
+    tier.head = loop->next;
+    if (tier.head == NULL) {
+      tier.tail = NULL;
+    }
+    pthread_mutex_unlock(&tier.mutex);
+
+    char name[32];
+    snprintf(name, sizeof(name), "loop%d", loop->serial);
+    atomic_store_explicit(&loop->function, CompileLoop(engine, &options, tier.ast, loop->node, tier.tape, name), memory_order_release);
+
+    pthread_mutex_lock(&tier.mutex);
+  }
+  pthread_mutex_unlock(&tier.mutex);
+  DisposeEngine(engine);
+  TearDownEngine();
+  return NULL;
+}
+
+/**
+ * Queue the hot loop to compile, start the background thread at the first one.
+ */
+static void QueueHotLoop(Loop loop) {
+  pthread_mutex_lock(&tier.mutex);
+  if (!tier.started) {
+    tier.started = pthread_create(&tier.thread, NULL, CompileHotLoops, NULL) == 0;
+  }
+  if (tier.tail == NULL) {
+    tier.head = loop;
+  } else {
+    tier.tail->next = loop;
+  }
+  tier.tail = loop;
+  pthread_cond_signal(&tier.ready);
+  pthread_mutex_unlock(&tier.mutex);
+}
+
+/**
+ * Stop the background thread, drop the loops not compiled yet.
+ */
+static void StopCompilingHotLoops(void) {
+  pthread_mutex_lock(&tier.mutex);
+  tier.stopped = true;
+  pthread_cond_signal(&tier.ready);
+  pthread_mutex_unlock(&tier.mutex);
+  if (tier.started) {
+    pthread_join(tier.thread, NULL);
+  }
+}
+
+/**
+ * Execute bytecode on the tape: each handler jumps to the handler of next operation directly.
+ * With loops of tiered mode, loop handlers count back edges and call the compiled loops.
+ */
+static void Execute(Bytecode code, unsigned char* tape, long size, Loop loops) {
+  static const void* handlers[] = {
+    [UpdateOpcode] = &&update,
+    [MoveOpcode] = &&move,
+    [InputOpcode] = &&input,
+    [OutputOpcode] = &&output,
+    [SetOpcode] = &&set,
+    [MultiplyOpcode] = &&multiply,
+    [ScanOpcode] = &&scan,
+    [WriteOpcode] = &&write,
+    [LoopBeginOpcode] = &&begin,
+    [LoopEndOpcode] = &&end,
+    [HaltOpcode] = &&halt
+  };
+  for (Bytecode operation = code; ; operation++) {
+    operation->handler = handlers[operation->opcode];
+    if (loops != NULL && operation->opcode == LoopBeginOpcode) {
+      operation->handler = &&tiered_begin;
+    } else if (loops != NULL && operation->opcode == LoopEndOpcode) {
+      operation->handler = &&tiered_end;
+    }
+    if (operation->opcode == HaltOpcode) {
+      break;
+    }
+  }
+
+  unsigned char* dp = tape;
+  unsigned char* limit = tape + size;
+  Bytecode pc = code;
+
+#define DISPATCH() goto *pc->handler
+#define NEXT() do { pc++; DISPATCH(); } while (false)
+
+  DISPATCH();
+
+update:
+  dp[pc->offset] += pc->parameter;
+  NEXT();
+move:
+  dp += pc->parameter;
+  NEXT();
+input: {
+  int value = bf_read();
+  dp[pc->offset] = value < 0 ? 0 : value;
+  NEXT();
+}
+output:
+  bf_write(dp[pc->offset]);
+  NEXT();
+set:
+  dp[pc->offset] = pc->parameter;
+  NEXT();
+multiply:
+  // the target cell is only touched if the loop body would run, it may be out of the tape otherwise.
+  if (dp[pc->offset] != 0) {
+    dp[pc->offset + pc->target] += dp[pc->offset] * pc->parameter;
+  }
+  NEXT();
+scan:
+  if (pc->parameter == 1 && dp < limit) {
+    unsigned char* zero = (unsigned char*)memchr(dp, 0, limit - dp);
+    dp = zero != NULL ? zero : limit;
+  } else {
+    while (*dp != 0) {
+      dp += pc->parameter;
+    }
+  }
+  NEXT();
+write:
+  bf_write_bytes(pc->bytes, pc->parameter);
+  NEXT();
+begin:
+  if (*dp == 0) {
+    pc = code + pc->parameter;
+    DISPATCH();
+  }
+  NEXT();
+end:
+  if (*dp != 0) {
+    pc = code + pc->parameter;
+    DISPATCH();
+  }
+  NEXT();
+tiered_begin:
+  if (*dp == 0) {
+    pc = code + pc->parameter;
+    DISPATCH();
+  } else {
+    LoopFunction function = atomic_load_explicit(&loops[pc->target].function, memory_order_acquire);
+    if (function != NULL) {
+      dp = function(dp);
+      pc = code + pc->parameter;
+      DISPATCH();
+    }
+  }
+  NEXT();
+tiered_end:
+  if (*dp != 0) {
+    // the back edge enters the loop again: call the compiled loop if ready.
+    Loop loop = &loops[pc->target];
+    LoopFunction function = atomic_load_explicit(&loop->function, memory_order_acquire);
+    if (function != NULL) {
+      dp = function(dp);
+      NEXT();
+    }
+    if (++loop->count == HOT_LOOP_THRESHOLD) {
+      QueueHotLoop(loop);
+    }
+    pc = code + pc->parameter;
+    DISPATCH();
+  }
+  NEXT();
+halt:
+  return;
+
+#undef NEXT
+#undef DISPATCH
+}
+
+/**
+ * Parse, optimize and interpret the source file, compile hot loops in background for tiered mode.
+ */
+void Interpret(char* source) {
+  Report report = options.report;
+  BeginPhase(report, ParsePhase);
+  Ast root = ParseSource(source, &options);
+  EndPhase(report, ParsePhase);
+  if (root == NULL) {
+    exit(EXIT_FAILURE);
+  }
+  BeginPhase(report, OptimizePhase);
+  root = OptimizeAst(root, report);
+  EndPhase(report, OptimizePhase);
+
+  BeginPhase(report, LowerPhase);
+  Bytecode code = LowerAst(root);
+  EndPhase(report, LowerPhase);
+  unsigned char* tape = options.guardedTape
+    ? bf_map_tape(options.tapeSize)
+    : (unsigned char*)calloc(sizeof(unsigned char), options.tapeSize);
+
+  Loop loops = NULL;
+  if (options.mode == TieredMode) {
+    int count = 0;
+    for (Bytecode operation = code; operation->opcode != HaltOpcode; operation++) {
+      count += operation->opcode == LoopBeginOpcode;
+    }
+    loops = (Loop)calloc(sizeof(struct _Loop), count + 1);
+    for (Bytecode operation = code; operation->opcode != HaltOpcode; operation++) {
+      if (operation->opcode == LoopBeginOpcode) {
+        loops[operation->target].node = operation - code;
+        loops[operation->target].serial = operation->target;
+      }
+    }
+    tier.ast = root;
+    tier.tape = tape;
+  }
+
+  BeginPhase(report, ExecutePhase);
+  bf_setup(options.bufferSize, options.lineBuffered);
+  Execute(code, tape, options.tapeSize, loops);
+  bf_flush();
+  EndPhase(report, ExecutePhase);
+
+  if (loops != NULL) {
+    StopCompilingHotLoops();
+    free(loops);
+  }
+
+  if (!options.guardedTape) {
+    free(tape);
+  }
+  free(code);
+  DisposeAst(root);
+}
@@ -0,0 +1,45 @@
+#ifndef __INTERPRETER_H_
+#define __INTERPRETER_H_
+
+#include "ast.h"
+
+/**
+ * Bytecode operation codes, the instruction ones are the same as InstructionSymbol.
+ */
+typedef enum {
+  UpdateOpcode = UpdateInstruction,
+  MoveOpcode = MoveInstruction,
+  InputOpcode = InputInstruction,
+  OutputOpcode = OutputInstruction,
+  SetOpcode = SetInstruction,
+  MultiplyOpcode = MultiplyInstruction,
+  ScanOpcode = ScanInstruction,
+  WriteOpcode = WriteInstruction,
+  /* jump to the operation after loop end if the cell is zero. */
+  LoopBeginOpcode,
+  /* jump to the operation after loop begin if the cell is not zero. */
+  LoopEndOpcode,
+  HaltOpcode
+} Opcode;
+
+/* Count of back edges to make a loop hot in tiered mode. */
+#define HOT_LOOP_THRESHOLD 10000
+
+/**
+ * Bytecode operation: the fields of instruction, at the same index as its node in AST.
+ * Loops keep the index to jump to in the parameter, the serial number of loop in the target.
+ */
+typedef struct _Bytecode {
+  /* address of the handler, resolved before execution. */
+  const void* handler;
+  Opcode opcode;
+  int parameter;
+  int offset;
+  int target;
+  unsigned char* bytes;
+} *Bytecode;
+
+Bytecode LowerAst(Ast);
+void Interpret(char*);
+
+#endif
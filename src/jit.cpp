@@ -0,0 +1,386 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/Mangling.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/MC/SubtargetFeature.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/CachePruning.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_sha1_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+
+extern "C" {
+#include "options.h"
+}
+#include "jit.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+/**
+ * JIT context, see JIT.
+ */
+struct _JIT {
+  /* inner lazy JIT: functions are compiled at their first call. */
+  std::unique_ptr<LLLazyJIT> jit;
+
+  /* target machine of JIT, to create one machine per optimization. */
+  std::unique_ptr<JITTargetMachineBuilder> machineBuilder;
+
+  /* optimization level: 0 ~ 3. */
+  int level;
+
+  /* target triple, CPU and features of host, detected by the engine. */
+  std::string triple;
+  std::string cpu;
+  std::string features;
+
+  /* directory of machine code cache, empty if the cache is disabled. */
+  std::string cacheDirectory;
+
+  /* compile threads running the tasks of JIT: splitting, compiling and linking modules. */
+  std::unique_ptr<ThreadPool> threads;
+
+  /* report of the tasks on compile threads, NULL if not required. */
+  Report report;
+
+  /* whether any object is stored to cache by compile threads, to prune the cache at dispose. */
+  std::atomic<bool> cacheStored;
+
+  /* external symbols waiting to be defined in JIT, and the defined ones. */
+  std::map<std::string, void*> pendingSymbols;
+  std::set<std::string> definedSymbols;
+};
+
+/**
+ * Code generation level of target machine for each optimization level.
+ */
+static CodeGenOpt::Level CodeGenLevels[] = {
+  CodeGenOpt::None,
+  CodeGenOpt::Less,
+  CodeGenOpt::Default,
+  CodeGenOpt::Aggressive
+};
+
+/**
+ * Optimization level of pass pipeline for each optimization level.
+ */
+static const OptimizationLevel* OptimizationLevels[] = {
+  &OptimizationLevel::O0,
+  &OptimizationLevel::O1,
+  &OptimizationLevel::O2,
+  &OptimizationLevel::O3
+};
+
+/**
+ * Report error and exit.
+ */
+static void CheckError(Error error, const char* action) {
+  if (error) {
+    fprintf(stderr, "LLVM %s failed: %s\n", action, toString(std::move(error)).c_str());
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * Return the value, or report error and exit.
+ */
+template <typename T>
+static T CheckValue(Expected<T> value, const char* action) {
+  CheckError(value.takeError(), action);
+  return std::move(*value);
+}
+
+/**
+ * Run the pass pipeline of the optimization level on the module before compiling it,
+ * the same pipeline as OptimizeModule.
+ */
+static void OptimizeJITModule(Module& module, TargetMachine* machine, int level) {
+  if (level == 0) {
+    return;
+  }
+
+  PipelineTuningOptions tuning;
+  tuning.LoopUnrolling = true;
+  tuning.LoopInterleaving = level >= 2;
+  tuning.LoopVectorization = level >= 2;
+  tuning.SLPVectorization = level >= 2;
+
+  LoopAnalysisManager loops;
+  FunctionAnalysisManager functions;
+  CGSCCAnalysisManager cgscc;
+  ModuleAnalysisManager modules;
+  PassBuilder builder(machine, tuning);
+  builder.registerModuleAnalyses(modules);
+  builder.registerCGSCCAnalyses(cgscc);
+  builder.registerFunctionAnalyses(functions);
+  builder.registerLoopAnalyses(loops);
+  builder.crossRegisterProxies(loops, functions, cgscc, modules);
+
+  ModulePassManager passes = builder.buildPerModuleDefaultPipeline(*OptimizationLevels[level]);
+  passes.run(module, modules);
+}
+
+/* Cache */
+
+/**
+ * Hash the module with everything affecting its machine code:
+ * compiler version, LLVM version, host CPU, optimization level and the bitcode.
+ * The source and the options are all compiled into the bitcode.
+ */
+static std::string HashModule(JIT jit, Module& module) {
+  raw_sha1_ostream stream;
+  stream << PROJECT_VERSION << '\0' << LLVM_VERSION_STRING << '\0'
+    << jit->machineBuilder->getCPU() << '\0' << jit->machineBuilder->getFeatures().getString() << '\0'
+    << jit->level << '\0';
+  WriteBitcodeToFile(module, stream);
+  return toHex(stream.sha1(), true);
+}
+
+/**
+ * Return the path of cached object with the key.
+ * The prefix is required by pruneCache.
+ */
+static std::string GetCachePath(JIT jit, const std::string& key) {
+  SmallString<128> path(jit->cacheDirectory);
+  sys::path::append(path, "llvmcache-" + key);
+  return std::string(path.str());
+}
+
+/**
+ * Load the cached object, and touch it to keep it from eviction.
+ * Return NULL if not cached.
+ */
+static std::unique_ptr<MemoryBuffer> LoadCachedObject(JIT jit, const std::string& key) {
+  std::string path = GetCachePath(jit, key);
+  int fd = -1;
+  if (sys::fs::openFileForRead(path, fd)) {
+    return nullptr;
+  }
+  auto object = MemoryBuffer::getOpenFile(fd, path, -1);
+  sys::fs::setLastAccessAndModificationTime(fd, std::chrono::system_clock::now());
+  close(fd);
+  return object ? std::move(*object) : nullptr;
+}
+
+/**
+ * Store the object to cache: write a temporary file then rename it,
+ * so the other processes never see a partial object. Failures only skip the cache.
+ */
+static void StoreCachedObject(JIT jit, const std::string& key, MemoryBufferRef object) {
+  SmallString<128> model(jit->cacheDirectory);
+  sys::path::append(model, "llvmcache-%%%%%%%%.tmp");
+  SmallString<128> temporary;
+  int fd = -1;
+  if (sys::fs::createUniqueFile(model, fd, temporary)) {
+    return;
+  }
+
+  raw_fd_ostream stream(fd, true);
+  stream << object.getBuffer();
+  stream.close();
+  if (stream.has_error()) {
+    stream.clear_error();
+    sys::fs::remove(temporary);
+  } else if (sys::fs::rename(temporary, GetCachePath(jit, key))) {
+    sys::fs::remove(temporary);
+  } else {
+    jit->cacheStored = true;
+  }
+}
+
+/**
+ * Evict the least recently used objects until the cache fits in the size limit.
+ */
+static void PruneCache(JIT jit) {
+  CachePruningPolicy policy;
+  policy.Interval = std::chrono::seconds(0);
+  policy.MaxSizeBytes = JIT_CACHE_SIZE_LIMIT;
+  pruneCache(jit->cacheDirectory, policy);
+}
+
+/**
+ * Compile each module with its own target machine on compile threads:
+ * load the object from cache, or optimize and compile the module then store the object.
+ */
+class CachedCompiler : public IRCompileLayer::IRCompiler {
+public:
+  CachedCompiler(JIT jit, JITTargetMachineBuilder builder)
+    : IRCompiler(irManglingOptionsFromTargetOptions(builder.getOptions())), jit(jit), builder(std::move(builder)) {}
+
+  Expected<std::unique_ptr<MemoryBuffer>> operator()(Module& module) override {
+    std::string key;
+    if (!jit->cacheDirectory.empty()) {
+      key = HashModule(jit, module);
+      if (auto object = LoadCachedObject(jit, key)) {
+        return std::move(object);
+      }
+    }
+
+    auto machine = builder.createTargetMachine();
+    if (!machine) {
+      return machine.takeError();
+    }
+    OptimizeJITModule(module, machine->get(), jit->level);
+    auto object = SimpleCompiler(**machine)(module);
+    if (object && !key.empty()) {
+      StoreCachedObject(jit, key, (*object)->getMemBufferRef());
+    }
+    return object;
+  }
+
+private:
+  JIT jit;
+  JITTargetMachineBuilder builder;
+};
+
+/**
+ * Define the pending external symbols as absolute addresses in JIT.
+ */
+static void DefinePendingSymbols(JIT jit) {
+  SymbolMap symbols;
+  for (auto& pending : jit->pendingSymbols) {
+    if (jit->definedSymbols.insert(pending.first).second) {
+      symbols[jit->jit->mangleAndIntern(pending.first)] = JITEvaluatedSymbol(
+        pointerToJITTargetAddress(pending.second),
+        JITSymbolFlags::Exported | JITSymbolFlags::Callable
+      );
+    }
+  }
+  jit->pendingSymbols.clear();
+  if (!symbols.empty()) {
+    CheckError(jit->jit->getMainJITDylib().define(absoluteSymbols(std::move(symbols))), "define JIT symbols");
+  }
+}
+
+/**
+ * Create lazy JIT for host machine, and compile threads up to the hardware concurrency.
+ * The machine code is cached in the user cache directory if required.
+ */
+static void SetUpJIT(JIT jit, int cached) {
+  SmallString<128> directory;
+  if (cached && sys::path::cache_directory(directory)) {
+    sys::path::append(directory, PROJECT_NAME);
+    if (!sys::fs::create_directories(directory)) {
+      jit->cacheDirectory = std::string(directory.str());
+    }
+  }
+
+  JITTargetMachineBuilder host{Triple(jit->triple)};
+  host.setCPU(jit->cpu);
+  host.addFeatures(SubtargetFeatures(jit->features).getFeatures());
+  host.setCodeGenOptLevel(CodeGenLevels[jit->level]);
+  jit->machineBuilder = std::make_unique<JITTargetMachineBuilder>(host);
+
+  unsigned threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), (unsigned)JIT_COMPILE_THREADS_LIMIT);
+  jit->jit = CheckValue(LLLazyJITBuilder()
+    .setJITTargetMachineBuilder(std::move(host))
+    .setNumCompileThreads(threads)
+    .setCompileFunctionCreator([jit](JITTargetMachineBuilder builder) -> Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> {
+      return std::make_unique<CachedCompiler>(jit, std::move(builder));
+    })
+    .create(), "create JIT");
+
+  // run the tasks on own compile threads instead, to add their time to the jit phase of report.
+  jit->threads = std::make_unique<ThreadPool>(hardware_concurrency(threads));
+  jit->jit->getExecutionSession().setDispatchTask([jit](std::unique_ptr<Task> task) {
+    // the task functions of thread pool are copied, so the task is moved by pointer.
+    jit->threads->async([jit, owned = task.release()]() {
+      std::unique_ptr<Task> task(owned);
+      PhaseClocks clocks = BeginConcurrentPhase(jit->report);
+      task->run();
+      EndConcurrentPhase(jit->report, JitPhase, clocks);
+    });
+  });
+
+  // the intrinsics of memory may be lowered to calls.
+  DefineJITSymbol(jit, (char*)"memcpy", (void*)&memcpy);
+  DefineJITSymbol(jit, (char*)"memmove", (void*)&memmove);
+  DefineJITSymbol(jit, (char*)"memset", (void*)&memset);
+}
+
+/**
+ * Create JIT with given optimization level for the host target, LLVM is not touched until the first module.
+ */
+JIT NewJIT(int level, char* triple, char* cpu, char* features) {
+  JIT jit = new _JIT();
+  jit->level = level;
+  jit->triple = triple;
+  jit->cpu = cpu;
+  jit->features = features;
+  jit->cacheStored = false;
+  return jit;
+}
+
+/**
+ * Destroy JIT and the machine code, prune the cache if anything is stored.
+ */
+void DisposeJIT(JIT jit) {
+  if (jit->threads) {
+    jit->threads->wait();
+  }
+  jit->jit.reset();
+  jit->threads.reset();
+  if (jit->cacheStored) {
+    PruneCache(jit);
+  }
+  delete jit;
+}
+
+/**
+ * Resolve the external symbol to the address in this process.
+ */
+void DefineJITSymbol(JIT jit, char* name, void* address) {
+  jit->pendingSymbols[name] = address;
+}
+
+/**
+ * Move the module and its context to JIT, set up JIT at the first module with cache if required.
+ * Lazy module is split per function, and each function is compiled at its first call.
+ * The compile threads add their time to the report if any.
+ */
+void AddJITModule(JIT jit, LLVMModuleRef module, int lazy, int cached, Report report) {
+  if (!jit->jit) {
+    SetUpJIT(jit, cached);
+  }
+  jit->report = report;
+  DefinePendingSymbols(jit);
+
+  std::unique_ptr<Module> owned(unwrap(module));
+  std::unique_ptr<LLVMContext> context(&owned->getContext());
+  ThreadSafeModule threadSafeModule(std::move(owned), std::move(context));
+  if (lazy) {
+    CheckError(jit->jit->addLazyIRModule(std::move(threadSafeModule)), "add lazy module");
+  } else {
+    CheckError(jit->jit->addIRModule(std::move(threadSafeModule)), "add module");
+  }
+}
+
+/**
+ * Look up the function, compile it if not compiled yet, and return its address.
+ */
+void* LookupJITSymbol(JIT jit, char* name) {
+  JITEvaluatedSymbol symbol = CheckValue(jit->jit->lookup(name), "look up symbol");
+  return jitTargetAddressToPointer<void*>(symbol.getAddress());
+}
@@ -0,0 +1,33 @@
+#ifndef __JIT_H_
+#define __JIT_H_
+
+#include <llvm-c/Core.h>
+
+#include "report.h"
+
+/* Max count of threads compiling functions concurrently. */
+#define JIT_COMPILE_THREADS_LIMIT 4
+
+/* Max size of the machine code cache directory in bytes. */
+#define JIT_CACHE_SIZE_LIMIT (64L << 20)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * Lazy JIT with its own symbols and machine code, set up at the first module.
+   */
+  typedef struct _JIT* JIT;
+
+  JIT NewJIT(int, char*, char*, char*);
+  void DisposeJIT(JIT);
+  void DefineJITSymbol(JIT, char*, void*);
+  void AddJITModule(JIT, LLVMModuleRef, int, int, Report);
+  void* LookupJITSymbol(JIT, char*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
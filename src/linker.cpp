@@ -1,6 +1,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <vector>
 
 #include <dirent.h>
@@ -9,6 +10,9 @@
 #include <lld/Common/Driver.h>
 #include <lld/Common/LLVM.h>
 
+extern "C" {
+#include "options.h"
+}
 #include "crt.h"
 #include "engine.h"
 #include "fs.h"
@@ -18,24 +22,31 @@ static char* crt1 = NULL;
 static char* crti = NULL;
 static char* crtn = NULL;
 static char* libc = NULL;
+static char* runtime = NULL;
+static char* freestanding = NULL;
+
+/* lld keeps global state, links run one at a time while the object code is emitted concurrently. */
+static std::mutex linking;
 
 /**
 * Shutdown linker and clear memory. // // 
 */
 void TearDownLinker() {
-  DeleteTemporaryFile(crt1);
-  DeleteTemporaryFile(crti);
-  DeleteTemporaryFile(crtn);
-  DeleteTemporaryFile(libc);
+  DeleteMemoryFile(crt1);
+  DeleteMemoryFile(crti);
+  DeleteMemoryFile(crtn);
+  DeleteMemoryFile(libc);
+  DeleteMemoryFile(runtime);
+  DeleteMemoryFile(freestanding);
+  crt1 = crti = crtn = libc = runtime = freestanding = NULL;
 }
 
-static char* SaveToTemporaryFile(unsigned char* content, unsigned int length) {
-  char* path = CreateTemporaryFileName();
-  FILE* file = fopen(path, "wb");
-  if (file != NULL) {
-    fwrite(content, sizeof(unsigned char), length, file);
-    fclose(file);
-  } else {
+/**
+ * Copy the embedded file to memory file, which is passed to lld by path.
+ */
+static char* SaveToMemoryFile(const char* name, unsigned char* content, unsigned int length) {
+  char* path = CreateMemoryFile(name, content, length);
+  if (path == NULL) {
     fprintf(stderr, "Generate C Runtime Library files failed!\n");
     exit(EXIT_FAILURE);
   }
@@ -43,34 +54,63 @@ static char* SaveToTemporaryFile(unsigned char* content, unsigned int length) {
 }
 
 /**
- * Search and initialize musl library path.
+ * Load the embedded runtime, with musl library or the freestanding runtime, to memory files.
+ * Nothing is written to disk. Files already loaded, e.g. by the server before serving requests, are kept.
  */
 void SetUpLinker() {
-  crt1 = SaveToTemporaryFile(SCRT1_O, SCRT1_O_LEN);
-  crti = SaveToTemporaryFile(CRTI_O, CRTI_O_LEN);
-  crtn = SaveToTemporaryFile(CRTN_O, CRTN_O_LEN);
-  libc = SaveToTemporaryFile(LIBC_A, LIBC_A_LEN);
+  if (runtime == NULL) {
+    runtime = SaveToMemoryFile("runtime.o", RUNTIME_O, RUNTIME_O_LEN);
+  }
+  if (options.freestanding) {
+    if (freestanding == NULL) {
+      freestanding = SaveToMemoryFile("freestanding.o", FREESTANDING_O, FREESTANDING_O_LEN);
+    }
+  } else if (libc == NULL) {
+    crt1 = SaveToMemoryFile("Scrt1.o", SCRT1_O, SCRT1_O_LEN);
+    crti = SaveToMemoryFile("crti.o", CRTI_O, CRTI_O_LEN);
+    crtn = SaveToMemoryFile("crtn.o", CRTN_O, CRTN_O_LEN);
+    libc = SaveToMemoryFile("libc.a", LIBC_A, LIBC_A_LEN);
+  }
 }
 
 /**
- * Link the object file to executable ELF file.
+ * Link the object code of engine to executable ELF file, the object code is emitted to memory file.
  */
-void Link(char* program) {
-  char* object = CreateTemporaryFileName();
-  EmitObjectFile(object);
+void Link(Engine engine, Options options, char* program) {
+  BeginPhase(options->report, EmitPhase);
+  LLVMMemoryBufferRef buffer = EmitObjectBuffer(engine);
+  EndPhase(options->report, EmitPhase);
+  ReportObject(options->report, LLVMGetBufferSize(buffer));
+
+  BeginPhase(options->report, LinkPhase);
+  char* object = SaveToMemoryFile("object.o", (unsigned char*)LLVMGetBufferStart(buffer), LLVMGetBufferSize(buffer));
+  LLVMDisposeMemoryBuffer(buffer);
 
   std::vector<const char *> args;
   args.push_back("ld.lld");
   args.push_back("-static");
   args.push_back("-o");
   args.push_back(program);
-  args.push_back(crt1);
-  args.push_back(crti);
-  args.push_back(object);
-  args.push_back(libc);
-  args.push_back(crtn);
+  if (options->freestanding) {
+    args.push_back("-nostdlib");
+    args.push_back(object);
+    args.push_back(runtime);
+    args.push_back(freestanding);
+  } else {
+    args.push_back(crt1);
+    args.push_back(crti);
+    args.push_back(object);
+    args.push_back(runtime);
+    args.push_back(libc);
+    args.push_back(crtn);
+  }
 
-  lld::elf::link(args, llvm::outs(), llvm::errs(), false, false);
+  {
+    std::lock_guard<std::mutex> lock(linking);
+    lld::elf::link(args, llvm::outs(), llvm::errs(), false, false);
+  }
 
-  DeleteTemporaryFile(object);
+  DeleteMemoryFile(object);
+  EndPhase(options->report, LinkPhase);
+  ReportOutput(options->report, program);
 }
@@ -1,13 +1,16 @@
 #ifndef __LINKER_H_
 #define __LINKER_H_
 
+#include "engine.h"
+#include "options.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
   void TearDownLinker(void);
   void SetUpLinker(void);
-  void Link(char*);
+  void Link(Engine, Options, char*);
 
 #ifdef __cplusplus
 }
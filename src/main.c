@@ -4,30 +4,66 @@
 #include "options.h"
 #include "engine.h"
 #include "compiler.h"
+#include "interpreter.h"
+#include "batch.h"
 #include "linker.h"
+#include "server.h"
 
 int main(int argc, char* argv[]) {
   ParseCommandLineArguments(argc, argv);
 
-  SetUpCompiler();
-  Compile(options.source);
+  if (options.mode == ServeMode) {
+    // returns in the worker process of each request, with the options of request.
+    Serve(options.socket);
+  } else if (options.socket != NULL) {
+    return Request(options.socket, argc, argv);
+  }
+
+  if (options.sourceCount > 1) {
+    return CompileBatch();
+  }
+
+  options.report = NewReport(options.source, options.timeReport);
+  if (options.mode == InterpretMode || options.mode == TieredMode) {
+    Interpret(options.source);
+    PrintReport(options.report, stderr);
+    DisposeReport(options.report);
+    return 0;
+  }
+
+  SetUpEngine();
+  Engine engine = NewEngine(options.optimizationLevel);
+  if (!Compile(engine, &options, options.source)) {
+    exit(EXIT_FAILURE);
+  }
   switch (options.mode) {
   case ScriptingMode:
-    ExecuteMachineCode();
+    // the JIT compiles the functions at their first call while executing, on its compile threads.
+    BeginPhase(options.report, ExecutePhase);
+    ExecuteMachineCode(engine, options.cacheEnabled, options.report);
+    EndPhase(options.report, ExecutePhase);
     break;
   case CompileMode:
-    EmitObjectFile(options.output);
+    BeginPhase(options.report, EmitPhase);
+    EmitObjectFile(engine, options.output);
+    EndPhase(options.report, EmitPhase);
     break;
   case RepresentationMode:
-    EmitIntermediateRepresentation(options.output);
+    BeginPhase(options.report, EmitPhase);
+    EmitIntermediateRepresentation(engine, options.output);
+    EndPhase(options.report, EmitPhase);
     break;
   default:
     SetUpLinker();
-    Link(options.output);
+    Link(engine, &options, options.output);
     TearDownLinker();
     break;
   }
-  TearDownCompiler();
+  DisposeEngine(engine);
+  TearDownEngine();
 
+  ReportOutput(options.report, options.output);
+  PrintReport(options.report, stderr);
+  DisposeReport(options.report);
   return 0;
 }
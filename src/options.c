@@ -3,8 +3,11 @@
 #include <string.h>
 #include <stdio.h>
 #include <getopt.h>
+#include <unistd.h>
 
 #include "options.h"
+#include "runtime.h"
+#include "compiler.h"
 
 /**
  * Configurations for getopt_long.
@@ -13,23 +16,61 @@ static struct option configs[] = {
   {"compile", no_argument, NULL, 'c'},
   {"representation", no_argument, NULL, 'r'},
   {"script", no_argument, NULL, 's'},
+  {"interpret", no_argument, NULL, 'i'},
+  {"tiered", no_argument, NULL, 'T'},
   {"enable-single-line-comment", no_argument, NULL, 'm'},
   {"output", required_argument, NULL, 'o'},
+  {"optimize", required_argument, NULL, 'O'},
+  {"buffer-size", required_argument, NULL, 'b'},
+  {"line-buffered", no_argument, NULL, 'l'},
+  {"tape-size", required_argument, NULL, 't'},
+  {"guarded-tape", no_argument, NULL, 'g'},
+  {"no-cache", no_argument, NULL, 'n'},
+  {"freestanding", no_argument, NULL, 'f'},
+  {"profile", optional_argument, NULL, 'P'},
+  {"profile-use", required_argument, NULL, 'U'},
+  {"manifest", required_argument, NULL, 'M'},
+  {"jobs", required_argument, NULL, 'j'},
+  {"serve", required_argument, NULL, 'S'},
+  {"connect", required_argument, NULL, 'C'},
+  {"time-report", optional_argument, NULL, 'R'},
   {"help", no_argument, NULL, 'h'},
   {"version", no_argument, NULL, 'v'},
   {0, 0, 0, 0}
 };
 
 /**
- * Shared command line options.
+ * Default command line options.
  */
-struct _Options options = {
+static const struct _Options defaults = {
   LinkMode,
   false,
+  2,
+  RUNTIME_BUFFER_SIZE,
+  false,
+  0,
+  false,
+  true,
+  false,
+  false,
+  NULL,
+  NULL,
+  0,
+  NULL,
   NULL,
+  0,
+  NULL,
+  NULL,
+  NULL,
+  NoReport,
   NULL,
 };
 
+/**
+ * Shared command line options.
+ */
+struct _Options options;
+
 /**
  * Free file name spaces.
  */
@@ -38,6 +79,18 @@ static void TearDownOptions(void) {
     free(options.output);
     options.output = NULL;
   }
+  // the first output is the output.
+  for (int index = 0; index < options.sourceCount; index++) {
+    free(options.sources[index]);
+    if (index > 0) {
+      free(options.outputs[index]);
+    }
+  }
+  free(options.sources);
+  free(options.outputs);
+  options.sources = NULL;
+  options.outputs = NULL;
+  options.sourceCount = 0;
 }
 
 /**
@@ -64,6 +117,139 @@ static char* CopyFileName(char* source, bool withExtension, char* suffix) {
   return target;
 }
 
+/**
+ * Create output file name next to the source file: keep the directory, strip the extension and append with suffix.
+ */
+static char* CopySiblingFileName(char* source, char* suffix) {
+  char* name = strrchr(source, '/');
+  char* end = strrchr(name == NULL ? source : name + 1, '.');
+  if (end == NULL) {
+    end = source + strlen(source);
+  }
+
+  int prefixLength = end - source;
+  int suffixLength = strlen(suffix);
+  char* target = (char*)calloc(sizeof(char), prefixLength + suffixLength + 1);
+  strncpy(target, source, prefixLength);
+  strncpy(target + prefixLength, suffix, suffixLength);
+
+  return target;
+}
+
+/**
+ * Create the absolute path of file with its directory resolved, the file itself may not exist yet.
+ * Return a copy of the path if the directory can't be resolved.
+ */
+static char* CopyResolvedPath(char* path) {
+  char* name = strrchr(path, '/');
+  char* directory = name == NULL ? strdup(".") : strndup(path, name - path + 1);
+  char* resolved = realpath(directory, NULL);
+  free(directory);
+  if (resolved == NULL) {
+    return strdup(path);
+  }
+  char* base = name == NULL ? path : name + 1;
+  int length = strlen(resolved) + strlen(base) + 2;
+  char* target = (char*)calloc(sizeof(char), length);
+  snprintf(target, length, "%s/%s", resolved, base);
+  free(resolved);
+  return target;
+}
+
+/**
+ * Reject the batch if two sources share an output file, or an output file would overwrite a source:
+ * the workers would write and link the same file concurrently, and one of the results would be lost.
+ */
+static void CheckOutputs(void) {
+  char** sources = (char**)calloc(sizeof(char*), options.sourceCount);
+  char** outputs = (char**)calloc(sizeof(char*), options.sourceCount);
+  for (int index = 0; index < options.sourceCount; index++) {
+    sources[index] = CopyResolvedPath(options.sources[index]);
+    outputs[index] = CopyResolvedPath(options.outputs[index]);
+  }
+  for (int index = 0; index < options.sourceCount; index++) {
+    for (int other = 0; other < options.sourceCount; other++) {
+      if (strcmp(outputs[index], sources[other]) == 0) {
+        fprintf(stderr, "Output file %s would overwrite source file %s!\n", options.outputs[index], options.sources[other]);
+        exit(EXIT_FAILURE);
+      } else if (other < index && strcmp(outputs[index], outputs[other]) == 0) {
+        fprintf(stderr, "Source files %s and %s have the same output file %s!\n", options.sources[other], options.sources[index], options.outputs[index]);
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+  for (int index = 0; index < options.sourceCount; index++) {
+    free(sources[index]);
+    free(outputs[index]);
+  }
+  free(sources);
+  free(outputs);
+}
+
+/**
+ * Parse size with optional binary suffix K, M or G, return -1 if invalid.
+ */
+static long ParseSize(char* text) {
+  char* suffix = NULL;
+  long long size = strtoll(text, &suffix, 10);
+  long long multiplier = 1;
+  switch (*suffix) {
+  case 'G': case 'g':
+    multiplier *= 1024;
+    __attribute__((fallthrough));
+  case 'M': case 'm':
+    multiplier *= 1024;
+    __attribute__((fallthrough));
+  case 'K': case 'k':
+    multiplier *= 1024;
+    suffix++;
+    break;
+  default:
+    break;
+  }
+  // check the limit before multiplying, so a huge size never wraps around.
+  if (suffix == text || *suffix != '\0' || size <= 0 || size > GUARDED_DATA_SEGMENT_SIZE_LIMIT / multiplier) {
+    return -1;
+  }
+  return (long)(size * multiplier);
+}
+
+/**
+ * Append a copy of source file name.
+ */
+static void AddSource(char* source) {
+  options.sources = (char**)realloc(options.sources, sizeof(char*) * (options.sourceCount + 1));
+  options.sources[options.sourceCount++] = strdup(source);
+}
+
+/**
+ * Append the source files listed in manifest file, one per line, `-` for standard input.
+ * Blank lines and lines starting with `#` are ignored.
+ */
+static void ReadManifest(char* manifest) {
+  FILE* file = strcmp(manifest, "-") == 0 ? stdin : fopen(manifest, "r");
+  if (file == NULL) {
+    fprintf(stderr, "Open manifest file %s failed!\n", manifest);
+    exit(EXIT_FAILURE);
+  }
+
+  char* line = NULL;
+  size_t capacity = 0;
+  ssize_t length = 0;
+  while ((length = getline(&line, &capacity, file)) >= 0) {
+    while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r' || line[length - 1] == ' ')) {
+      line[--length] = '\0';
+    }
+    if (length > 0 && line[0] != '#') {
+      AddSource(line);
+    }
+  }
+  free(line);
+  if (file != stdin) {
+    fclose(file);
+  }
+}
+
 /**
  * Show bug report and exit.
  */
@@ -79,9 +265,10 @@ static void BugReport(void) {
 static void Help(void) {
   fprintf(stderr, "Overview: brainfuck compiler and interpreter.\n\n");
 
-  fprintf(stderr, "Usage: %s [OPTIONS] <source-file>\n\n", PROJECT_NAME);
+  fprintf(stderr, "Usage: %s [OPTIONS] <source-file>...\n\n", PROJECT_NAME);
 
   fprintf(stderr, "  It will create an executable file without options.\n\n");
+  fprintf(stderr, "  Many source files are compiled concurrently in batch, with -c, -r or without options.\n\n");
 
   fprintf(stderr, "OPTIONS:\n\n");
 
@@ -93,7 +280,15 @@ static void Help(void) {
   fprintf(stderr, "    Emit LLVM representation (.ll) to standard output.\n\n");
 
   fprintf(stderr, "  -s/--script\n\n");
-  fprintf(stderr, "    Run source file as Brainfuck script.\n\n");
+  fprintf(stderr, "    Run source file as Brainfuck script. Top level loops of large scripts are compiled at their first call.\n\n");
+
+  fprintf(stderr, "  -i/--interpret\n\n");
+  fprintf(stderr, "    Run source file with bytecode interpreter, without initializing LLVM.\n\n");
+  fprintf(stderr, "    It starts faster than scripting, and suits short scripts.\n\n");
+
+  fprintf(stderr, "  -T/--tiered\n\n");
+  fprintf(stderr, "    Run source file with bytecode interpreter, and compile hot loops with LLVM in background.\n\n");
+  fprintf(stderr, "    The compiled loop takes over at the next loop entry. It suits both short and long running scripts.\n\n");
 
   fprintf(stderr, "  -m/--enable-single-line-comment\n\n");
   fprintf(stderr, "    Enable single line comment command `#`.\n\n");
@@ -104,6 +299,57 @@ static void Help(void) {
   fprintf(stderr, "    This applies to whatever sort of output is being produced, whether it be an executable file, an object file, an IR file.\n\n");
   fprintf(stderr, "    If -o is not specified, the default executable file name for a source file is made by removing the extension.\n\n");
 
+  fprintf(stderr, "  -O/--optimize <level>\n\n");
+  fprintf(stderr, "    Optimization level: 0, 1, 2 or 3. Defaults to 2.\n\n");
+  fprintf(stderr, "    It applies to all modes: scripting, compiling, linking and emitting representation.\n\n");
+
+  fprintf(stderr, "  -b/--buffer-size <bytes>\n\n");
+  fprintf(stderr, "    Flush output when the pending bytes reach the size. Defaults to %d, at most %d.\n\n", RUNTIME_BUFFER_SIZE, RUNTIME_BUFFER_CAPACITY);
+  fprintf(stderr, "    Output is always flushed before reading input and at exit.\n\n");
+
+  fprintf(stderr, "  -l/--line-buffered\n\n");
+  fprintf(stderr, "    Flush output at end of each line.\n\n");
+
+  fprintf(stderr, "  -t/--tape-size <bytes>\n\n");
+  fprintf(stderr, "    Size of data segment, with optional suffix K, M or G. Defaults to %d, at most 1G.\n\n", DATA_SEGMENT_SIZE);
+
+  fprintf(stderr, "  -g/--guarded-tape\n\n");
+  fprintf(stderr, "    Map data segment surrounded by guard pages at runtime, pages are committed on touch.\n\n");
+  fprintf(stderr, "    Moving out of bounds is reported as error. Tape size defaults to 4G, at most 1T.\n\n");
+
+  fprintf(stderr, "  -n/--no-cache\n\n");
+  fprintf(stderr, "    Neither load nor store machine code of scripts in the cache directory ~/.cache/brainfuck.\n\n");
+
+  fprintf(stderr, "  -f/--freestanding\n\n");
+  fprintf(stderr, "    Link executable file with a tiny runtime of raw system calls instead of musl libc.\n\n");
+  fprintf(stderr, "    The executable file takes a few KB, and starts without any libc initialization.\n\n");
+
+  fprintf(stderr, "  -P/--profile[=<profile-file>]\n\n");
+  fprintf(stderr, "    Count entries and iterations of each loop, and report the hottest loops to standard error at exit.\n\n");
+  fprintf(stderr, "    It applies to scripting and executable files, the loops are shown by line and column of `[`.\n\n");
+  fprintf(stderr, "    The counters are also written to profile file at exit if given, for -U.\n\n");
+
+  fprintf(stderr, "  -U/--profile-use <profile-file>\n\n");
+  fprintf(stderr, "    Optimize with the loop profile written by the program instrumented with -P: branch weights of loops,\n");
+  fprintf(stderr, "    unrolling and vectorization of hot loops, and layout of cold blocks.\n\n");
+
+  fprintf(stderr, "  -M/--manifest <manifest-file>\n\n");
+  fprintf(stderr, "    Compile the source files listed in manifest file in batch, one per line, `-` for standard input.\n\n");
+  fprintf(stderr, "    The output file names are made from the source file names, next to the source files; -o is not allowed in batch.\n\n");
+
+  fprintf(stderr, "  -j/--jobs <count>\n\n");
+  fprintf(stderr, "    Count of threads compiling source files in batch. Defaults to the count of processors.\n\n");
+
+  fprintf(stderr, "  -S/--serve <socket-file>\n\n");
+  fprintf(stderr, "    Run as server: listen on the socket, and serve the requests of clients with LLVM set up once.\n\n");
+
+  fprintf(stderr, "  -C/--connect <socket-file>\n\n");
+  fprintf(stderr, "    Send the command line, working directory and standard streams to the server, and exit with its result.\n\n");
+
+  fprintf(stderr, "  -R/--time-report[=<format>]\n\n");
+  fprintf(stderr, "    Print wall time, CPU time and peak RSS of each phase, AST node counts, LLVM IR and output sizes to standard error.\n\n");
+  fprintf(stderr, "    Format: text or json, defaults to text. A JSON report takes one line for each source file.\n\n");
+
   fprintf(stderr, "  -h/--help\n\n");
   fprintf(stderr, "    Show this help and exit.\n\n");
 
@@ -117,6 +363,7 @@ static void Help(void) {
 
   fprintf(stderr, "  3. Using with Shebang:\n\n");
   fprintf(stderr, "    #!/usr/local/bin/brainfuck -ms\n\n");
+  fprintf(stderr, "    #!/usr/local/bin/brainfuck -mi\n\n");
 
   fprintf(stderr, "  4. Creating native object file:\n\n");
   fprintf(stderr, "    brainfuck -c helloworld.bf\n\n");
@@ -124,6 +371,13 @@ static void Help(void) {
   fprintf(stderr, "  5. Creating LLVM representation file:\n\n");
   fprintf(stderr, "    brainfuck -r helloworld.bf\n\n");
 
+  fprintf(stderr, "  6. Creating executable files of all source files in directory:\n\n");
+  fprintf(stderr, "    brainfuck *.bf\n\n");
+
+  fprintf(stderr, "  7. Compiling with a running server:\n\n");
+  fprintf(stderr, "    brainfuck -S /tmp/brainfuck.sock &\n\n");
+  fprintf(stderr, "    brainfuck -C /tmp/brainfuck.sock -s helloworld.bf\n\n");
+
   BugReport();
 }
 
@@ -138,13 +392,26 @@ void Version(void) {
 
 /**
  * Parse command line arguments with getopt_long and return parsed options.
+ * It starts over from the default options, the server parses the arguments of each request again.
  */
 void ParseCommandLineArguments(int argc, char* argv[]) {
-  atexit(TearDownOptions);
+  static bool registered = false;
+  if (!registered) {
+    atexit(TearDownOptions);
+    registered = true;
+  }
+  // The worker process of server parses the arguments of request again, they are never sent to server then.
+  bool serving = options.mode == ServeMode;
+  TearDownOptions();
+  options = defaults;
+  optind = 0;
+  char* output = NULL;
+  char* manifest = NULL;
+  char* server = NULL;
 
   while (true) {
     int index = 0;
-    int charactor = getopt_long(argc, argv, "crsmo:hv", configs, &index);
+    int charactor = getopt_long(argc, argv, "crsiTmo:O:b:lt:gnfP::U:M:j:S:C:R::hv", configs, &index);
     if (charactor < 0) {
       break;
     }
@@ -159,11 +426,80 @@ void ParseCommandLineArguments(int argc, char* argv[]) {
     case 's':
       options.mode = ScriptingMode;
       break;
+    case 'i':
+      options.mode = InterpretMode;
+      break;
+    case 'T':
+      options.mode = TieredMode;
+      break;
     case 'm':
       options.singleLineCommentEnabled = 1;
       break;
     case 'o':
-      options.output = optarg;
+      output = optarg;
+      break;
+    case 'O':
+      if (strlen(optarg) == 1 && optarg[0] >= '0' && optarg[0] <= '3') {
+        options.optimizationLevel = optarg[0] - '0';
+      } else {
+        Help();
+      }
+      break;
+    case 'b':
+      options.bufferSize = atoi(optarg);
+      if (options.bufferSize <= 0 || options.bufferSize > RUNTIME_BUFFER_CAPACITY) {
+        Help();
+      }
+      break;
+    case 'l':
+      options.lineBuffered = true;
+      break;
+    case 't':
+      options.tapeSize = ParseSize(optarg);
+      if (options.tapeSize <= 0) {
+        Help();
+      }
+      break;
+    case 'g':
+      options.guardedTape = true;
+      break;
+    case 'n':
+      options.cacheEnabled = false;
+      break;
+    case 'f':
+      options.freestanding = true;
+      break;
+    case 'P':
+      options.profile = true;
+      options.profileFile = optarg;
+      break;
+    case 'U':
+      options.profileUse = optarg;
+      break;
+    case 'M':
+      manifest = optarg;
+      break;
+    case 'j':
+      options.jobs = atoi(optarg);
+      if (options.jobs <= 0) {
+        Help();
+      }
+      break;
+    case 'S':
+      options.mode = ServeMode;
+      options.socket = optarg;
+      break;
+    case 'C':
+      server = optarg;
+      break;
+    case 'R':
+      if (optarg == NULL || strcmp(optarg, "text") == 0) {
+        options.timeReport = TextReport;
+      } else if (strcmp(optarg, "json") == 0) {
+        options.timeReport = JsonReport;
+      } else {
+        Help();
+      }
       break;
     case 'v':
       Version();
@@ -173,21 +509,69 @@ void ParseCommandLineArguments(int argc, char* argv[]) {
     }
   }
 
-  // Only accept one source file.
-  if (optind + 1 == argc) {
-    options.source = argv[optind];
-  } else {
+  if (options.mode == ServeMode && (serving || server != NULL)) {
     Help();
+  } else if (server != NULL && !serving) {
+    // The client sends the arguments to server as they are, the server checks them.
+    options.socket = server;
+    return;
   }
 
-  if (options.output == NULL) {
-    if (options.mode == CompileMode) {
-      options.output = CopyFileName(options.source, false, ".o");
-    } else if (options.mode == LinkMode) {
-      options.output = CopyFileName(options.source, false, "");
+  // Source files from arguments and manifest, only one source file for running and -o.
+  for (int index = optind; index < argc; index++) {
+    AddSource(argv[index]);
+  }
+  if (manifest != NULL) {
+    ReadManifest(manifest);
+  }
+  // The server takes source files from requests.
+  if (options.mode == ServeMode) {
+    if (options.sourceCount > 0) {
+      Help();
     }
-  } else {
+    return;
+  }
+  if (options.sourceCount == 0) {
+    Help();
+  }
+  if (options.sourceCount > 1 && (output != NULL
+      || options.mode == ScriptingMode || options.mode == InterpretMode || options.mode == TieredMode)) {
+    Help();
+  }
+  options.source = options.sources[0];
+  if (options.jobs == 0) {
+    options.jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  // The bytecode interpreter isn't instrumented, and a profile file is of one source file.
+  if ((options.profile || options.profileUse != NULL) && (options.mode == InterpretMode || options.mode == TieredMode)) {
+    Help();
+  } else if ((options.profileFile != NULL || options.profileUse != NULL) && options.sourceCount > 1) {
+    Help();
+  }
+
+  if (options.tapeSize == 0) {
+    options.tapeSize = options.guardedTape ? GUARDED_DATA_SEGMENT_SIZE : DATA_SEGMENT_SIZE;
+  } else if (!options.guardedTape && options.tapeSize > DATA_SEGMENT_SIZE_LIMIT) {
+    Help();
+  }
+
+  // Output file names are made from the source file names, next to the source files in batch.
+  char* suffix = options.mode == CompileMode ? ".o" : options.mode == RepresentationMode ? ".ll" : "";
+  if (output != NULL) {
     // Clone a copy
-    options.output = CopyFileName(options.output, false, "");
+    options.output = CopyFileName(output, false, "");
+  } else if (options.sourceCount > 1) {
+    options.output = CopySiblingFileName(options.source, suffix);
+  } else if (options.mode == CompileMode || options.mode == LinkMode) {
+    options.output = CopyFileName(options.source, false, suffix);
+  }
+  options.outputs = (char**)calloc(sizeof(char*), options.sourceCount);
+  options.outputs[0] = options.output;
+  for (int index = 1; index < options.sourceCount; index++) {
+    options.outputs[index] = CopySiblingFileName(options.sources[index], suffix);
+  }
+  if (options.sourceCount > 1) {
+    CheckOutputs();
   }
 }
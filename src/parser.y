@@ -1,51 +1,89 @@
-%{
-#include "scanner.h"
-#include "parser.h"
+%define api.pure full
+%param {Scanner scanner}
+%parse-param {Ast ast}
+
+%code requires {
 #include "ast.h"
+#include "options.h"
+#include "scanner.h"
+}
 
-void yyerror(char*);
-%}
+%code provides {
+Ast ParseSource(char*, Options);
+}
+
+%code {
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The parser stacks are allocated on heap and grow on demand: the nesting of loops is only limited by memory. */
+#define YYMAXDEPTH (1 << 28)
+
+int yylex(YYSTYPE*, Scanner);
+static void yyerror(Scanner, Ast, const char*);
+}
 
 %union {
-  struct _Ast* ast;
-  struct _Instruction* instruction;
+  int index;
+  int parameter;
+  Location location;
   yytoken_kind_t token;
 }
 
-%token <token> INCREMENT DECREMENT FORWARD BACKWARD INPUT OUTPUT WHILE WEND
+%token <parameter> UPDATE MOVE
+%token <location> WHILE
+%token <token> INPUT OUTPUT WEND
 
-%type <ast> commands command
-%type <instruction> form
+%type <index> begin
 
 %%
 
-brainfuck: commands { AstRoot = $1; }
+brainfuck: commands
   ;
 
-commands: %empty { $$ = NULL; }
-  | commands command {
-    $2->previous = $1;
-    $$ = $2;
+commands: %empty
+  | commands command
+  ;
+
+command: form
+  | begin commands WEND {
+    Node end = AppendNode(ast, BlockEndNode);
+    end->jump = $1;
+    ast->nodes[$1].jump = ast->count - 1;
   }
   ;
 
-command: form { $$ = NewInstructionNode(InstructionNode, $1, NULL); }
-  | WHILE commands WEND { $$ = NewBlockNode(BlockNode, $2, NULL); }
+begin: WHILE {
+    $$ = ast->count;
+    AppendNode(ast, BlockNode)->location = $1;
+  }
   ;
 
-form: INCREMENT { $$ = NewInstruction(UpdateInstruction, 1); }
-  | DECREMENT { $$ = NewInstruction(UpdateInstruction, -1); }
-  | FORWARD { $$ = NewInstruction(MoveInstruction, 1); }
-  | BACKWARD { $$ = NewInstruction(MoveInstruction, -1); }
-  | INPUT { $$ = NewInstruction(InputInstruction, 1); }
-  | OUTPUT { $$ = NewInstruction(OutputInstruction, 1); }
+form: UPDATE { MergeInstruction(ast, UpdateInstruction, $1); }
+  | MOVE { MergeInstruction(ast, MoveInstruction, $1); }
+  | INPUT { AppendInstruction(ast, InputInstruction, 1); }
+  | OUTPUT { AppendInstruction(ast, OutputInstruction, 1); }
   ;
 
 %%
 
 /**
- * Global error handler.
+ * Error handler of the parser.
+ */
+static void yyerror(Scanner scanner, Ast ast, const char* message) {
+  fprintf(stderr, "Error at line %d of %s: %s\n", ScannerLineNumber(scanner), scanner->options->source, message);
+}
+
+/**
+ * Parse the source file to AST in program order with a scanner of its own, return NULL if the source is invalid.
  */
-void yyerror(char* message) {
-  fprintf(stderr, "Error at line %d: %s\n", yylineno, message);
+Ast ParseSource(char* source, Options options) {
+  Scanner scanner = NewScanner(source, options);
+  Ast ast = NewAst();
+  if (yyparse(scanner, ast) != 0) {
+    DisposeAst(ast);
+    ast = NULL;
+  }
+  DisposeScanner(scanner);
+  return ast;
 }
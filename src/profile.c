@@ -0,0 +1,105 @@
+/**
+ * Profile file: the counters of loops written by the program instrumented with --profile, one line per loop.
+ *
+ * The loops are identified by the source location of `[`, so the profile applies to the same source file with any
+ * optimization level. The profiles of many runs can be concatenated into one file, their counters are added.
+ */
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "profile.h"
+
+/* Initial capacity of loops. */
+#define PROFILE_CAPACITY 64
+
+struct _Profile {
+  /* loops sorted by source location, unique. */
+  LoopProfile* loops;
+  int count;
+  /* iterations of all loops. */
+  int64_t iterations;
+};
+
+static int CompareLocation(const void* left, const void* right) {
+  const LoopProfile* loop = (const LoopProfile*)left;
+  const LoopProfile* other = (const LoopProfile*)right;
+  if (loop->line != other->line) {
+    return loop->line < other->line ? -1 : 1;
+  }
+  return loop->column < other->column ? -1 : loop->column > other->column;
+}
+
+/**
+ * Read profile file, exit if it can't be read.
+ */
+Profile LoadProfile(char* filename) {
+  FILE* file = fopen(filename, "r");
+  if (file == NULL) {
+    fprintf(stderr, "Open profile file %s failed!\n", filename);
+    exit(EXIT_FAILURE);
+  }
+
+  Profile profile = (Profile)calloc(sizeof(struct _Profile), 1);
+  int capacity = PROFILE_CAPACITY;
+  profile->loops = (LoopProfile*)calloc(capacity, sizeof(LoopProfile));
+  char line[256];
+  for (int number = 1; fgets(line, sizeof(line), file) != NULL; number++) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    LoopProfile loop = { 0 };
+    if (sscanf(line, "%" SCNd64 " %" SCNd64 " %" SCNd64 " %" SCNd64, &loop.line, &loop.column, &loop.entries, &loop.iterations) != 4
+        || loop.entries < 0 || loop.iterations < 0) {
+      fprintf(stderr, "Invalid profile file %s at line %d!\n", filename, number);
+      exit(EXIT_FAILURE);
+    }
+    if (profile->count == capacity) {
+      capacity *= 2;
+      profile->loops = (LoopProfile*)realloc(profile->loops, capacity * sizeof(LoopProfile));
+    }
+    profile->loops[profile->count++] = loop;
+  }
+  fclose(file);
+
+  // add up the counters of the same loop from many runs.
+  qsort(profile->loops, profile->count, sizeof(LoopProfile), CompareLocation);
+  int count = 0;
+  for (int index = 0; index < profile->count; index++) {
+    LoopProfile* loop = &profile->loops[index];
+    if (count > 0 && CompareLocation(&profile->loops[count - 1], loop) == 0) {
+      profile->loops[count - 1].entries += loop->entries;
+      profile->loops[count - 1].iterations += loop->iterations;
+    } else {
+      profile->loops[count++] = *loop;
+    }
+    profile->iterations += loop->iterations;
+  }
+  profile->count = count;
+  return profile;
+}
+
+/**
+ * Destructor for profile.
+ */
+void DisposeProfile(Profile profile) {
+  if (profile != NULL) {
+    free(profile->loops);
+    free(profile);
+  }
+}
+
+/**
+ * Find the loop at source location, NULL if it's not recorded.
+ */
+LoopProfile* FindLoopProfile(Profile profile, int line, int column) {
+  LoopProfile key = { .line = line, .column = column };
+  return (LoopProfile*)bsearch(&key, profile->loops, profile->count, sizeof(LoopProfile), CompareLocation);
+}
+
+/**
+ * Count of iterations of all loops.
+ */
+int64_t ProfileIterations(Profile profile) {
+  return profile->iterations;
+}
@@ -0,0 +1,16 @@
+#ifndef __PROFILE_H_
+#define __PROFILE_H_
+
+#include "runtime.h"
+
+/**
+ * Loop profile recorded by the instrumented program, the loops are looked up by source location of `[`.
+ */
+typedef struct _Profile* Profile;
+
+Profile LoadProfile(char*);
+void DisposeProfile(Profile);
+LoopProfile* FindLoopProfile(Profile, int, int);
+int64_t ProfileIterations(Profile);
+
+#endif
@@ -0,0 +1,325 @@
+/**
+ * Time report: where the time and memory of compiling a source file go, phase by phase.
+ *
+ * Wall time is measured with the monotonic clock, CPU time with the clock of calling thread, so the reports of
+ * source files compiled concurrently in batch don't mix. Peak RSS is of the whole process at the end of phase.
+ * The phases run on other threads, e.g. compile threads of JIT, are summed over all their runs.
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "report.h"
+
+/**
+ * Measurement of a phase, accumulated if measured many times.
+ */
+typedef struct _Measurement {
+  int count;
+  double wall;
+  double cpu;
+  long rss;
+  /* clocks at the beginning of the running measurement. */
+  double wallBegin;
+  double cpuBegin;
+} Measurement;
+
+/**
+ * Count of AST nodes after a stage.
+ */
+typedef struct _AstStage {
+  char* name;
+  int nodes;
+} AstStage;
+
+/**
+ * Statistics of LLVM IR after a stage.
+ */
+typedef struct _ModuleStage {
+  char* name;
+  int functions;
+  int blocks;
+  int instructions;
+} ModuleStage;
+
+struct _Report {
+  char* source;
+  ReportFormat format;
+  /* guards the phases measured concurrently. */
+  pthread_mutex_t mutex;
+  Measurement phases[PhaseCount];
+  int astStageCount;
+  AstStage astStages[REPORT_STAGE_LIMIT];
+  int moduleStageCount;
+  ModuleStage moduleStages[REPORT_STAGE_LIMIT];
+  /* size of object code and output file in bytes, -1 if unknown. */
+  long object;
+  long output;
+};
+
+/* Names of phases in report. */
+static const char* phaseNames[] = {
+  "parse",
+  "optimize",
+  "evaluate",
+  "generate",
+  "optimize-ir",
+  "lower",
+  "emit",
+  "link",
+  "jit",
+  "execute"
+};
+
+/**
+ * Seconds of the clock.
+ */
+static double Now(clockid_t clock) {
+  struct timespec time;
+  clock_gettime(clock, &time);
+  return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Peak resident set size of process in KB.
+ */
+static long PeakResidentSetSize(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+/* Report */
+
+/**
+ * Create report of source file, NULL if no report is required.
+ */
+Report NewReport(char* source, ReportFormat format) {
+  if (format == NoReport) {
+    return NULL;
+  }
+  Report report = (Report)calloc(sizeof(struct _Report), 1);
+  report->source = strdup(source);
+  report->format = format;
+  report->object = -1;
+  report->output = -1;
+  pthread_mutex_init(&report->mutex, NULL);
+  return report;
+}
+
+/**
+ * Destructor for report.
+ */
+void DisposeReport(Report report) {
+  if (report != NULL) {
+    pthread_mutex_destroy(&report->mutex);
+    free(report->source);
+    free(report);
+  }
+}
+
+/**
+ * Start measuring the phase.
+ */
+void BeginPhase(Report report, Phase phase) {
+  if (report != NULL) {
+    report->phases[phase].wallBegin = Now(CLOCK_MONOTONIC);
+    report->phases[phase].cpuBegin = Now(CLOCK_THREAD_CPUTIME_ID);
+  }
+}
+
+/**
+ * Stop measuring the phase, and add the times to it.
+ */
+void EndPhase(Report report, Phase phase) {
+  if (report != NULL) {
+    Measurement* measurement = &report->phases[phase];
+    measurement->count++;
+    measurement->wall += Now(CLOCK_MONOTONIC) - measurement->wallBegin;
+    measurement->cpu += Now(CLOCK_THREAD_CPUTIME_ID) - measurement->cpuBegin;
+    measurement->rss = PeakResidentSetSize();
+  }
+}
+
+/**
+ * Start measuring a phase on the calling thread, which may run concurrently with other phases.
+ */
+PhaseClocks BeginConcurrentPhase(Report report) {
+  PhaseClocks clocks = { 0, 0 };
+  if (report != NULL) {
+    clocks.wall = Now(CLOCK_MONOTONIC);
+    clocks.cpu = Now(CLOCK_THREAD_CPUTIME_ID);
+  }
+  return clocks;
+}
+
+/**
+ * Stop measuring the phase on the calling thread, and add the times to it.
+ */
+void EndConcurrentPhase(Report report, Phase phase, PhaseClocks clocks) {
+  if (report != NULL) {
+    double wall = Now(CLOCK_MONOTONIC) - clocks.wall;
+    double cpu = Now(CLOCK_THREAD_CPUTIME_ID) - clocks.cpu;
+    pthread_mutex_lock(&report->mutex);
+    Measurement* measurement = &report->phases[phase];
+    measurement->count++;
+    measurement->wall += wall;
+    measurement->cpu += cpu;
+    measurement->rss = PeakResidentSetSize();
+    pthread_mutex_unlock(&report->mutex);
+  }
+}
+
+/**
+ * Record the count of AST nodes after the stage, the name is a string literal.
+ */
+void ReportAstNodes(Report report, char* stage, int nodes) {
+  if (report != NULL && report->astStageCount < REPORT_STAGE_LIMIT) {
+    report->astStages[report->astStageCount++] = (AstStage){ stage, nodes };
+  }
+}
+
+/**
+ * Record the count of defined functions, basic blocks and instructions of LLVM IR after the stage.
+ */
+void ReportModule(Report report, char* stage, int functions, int blocks, int instructions) {
+  if (report != NULL && report->moduleStageCount < REPORT_STAGE_LIMIT) {
+    report->moduleStages[report->moduleStageCount++] = (ModuleStage){ stage, functions, blocks, instructions };
+  }
+}
+
+/**
+ * Record the size of object code in bytes.
+ */
+void ReportObject(Report report, long size) {
+  if (report != NULL) {
+    report->object = size;
+  }
+}
+
+/**
+ * Record the size of output file, unknown for standard output.
+ */
+void ReportOutput(Report report, char* filename) {
+  struct stat status;
+  if (report != NULL && filename != NULL && stat(filename, &status) == 0) {
+    report->output = status.st_size;
+  }
+}
+
+/* Print */
+
+/**
+ * Print string in JSON with escapes.
+ */
+static void PrintJsonString(FILE* file, char* text) {
+  fputc('"', file);
+  for (unsigned char* c = (unsigned char*)text; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      fprintf(file, "\\%c", *c);
+    } else if (*c < 0x20) {
+      fprintf(file, "\\u%04x", *c);
+    } else {
+      fputc(*c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static void PrintText(Report report, FILE* file) {
+  fprintf(file, "Time report of %s:\n\n", report->source);
+  fprintf(file, "  %-12s %12s %12s %16s\n", "phase", "wall (ms)", "cpu (ms)", "peak rss (KB)");
+  double wall = 0;
+  double cpu = 0;
+  for (int phase = 0; phase < PhaseCount; phase++) {
+    Measurement* measurement = &report->phases[phase];
+    if (measurement->count > 0) {
+      fprintf(file, "  %-12s %12.3f %12.3f %16ld\n", phaseNames[phase], measurement->wall * 1e3, measurement->cpu * 1e3, measurement->rss);
+      // execution waits for the functions compiled by JIT, its wall time is already in execute.
+      wall += phase == JitPhase ? 0 : measurement->wall;
+      cpu += measurement->cpu;
+    }
+  }
+  fprintf(file, "  %-12s %12.3f %12.3f\n\n", "total", wall * 1e3, cpu * 1e3);
+
+  if (report->astStageCount > 0) {
+    fprintf(file, "  AST nodes:");
+    for (int index = 0; index < report->astStageCount; index++) {
+      fprintf(file, "%s %s %d", index > 0 ? "," : "", report->astStages[index].name, report->astStages[index].nodes);
+    }
+    fprintf(file, "\n");
+  }
+  for (int index = 0; index < report->moduleStageCount; index++) {
+    ModuleStage* stage = &report->moduleStages[index];
+    fprintf(file, "  LLVM IR %s: %d functions, %d blocks, %d instructions\n", stage->name, stage->functions, stage->blocks, stage->instructions);
+  }
+  if (report->object >= 0) {
+    fprintf(file, "  Object: %ld bytes\n", report->object);
+  }
+  if (report->output >= 0) {
+    fprintf(file, "  Output: %ld bytes\n", report->output);
+  }
+}
+
+static void PrintJson(Report report, FILE* file) {
+  fprintf(file, "{\"source\":");
+  PrintJsonString(file, report->source);
+
+  fprintf(file, ",\"phases\":[");
+  bool first = true;
+  for (int phase = 0; phase < PhaseCount; phase++) {
+    Measurement* measurement = &report->phases[phase];
+    if (measurement->count > 0) {
+      fprintf(file, "%s{\"phase\":\"%s\",\"wall_ms\":%.3f,\"cpu_ms\":%.3f,\"peak_rss_kb\":%ld}", first ? "" : ",",
+        phaseNames[phase], measurement->wall * 1e3, measurement->cpu * 1e3, measurement->rss);
+      first = false;
+    }
+  }
+
+  fprintf(file, "],\"ast\":[");
+  for (int index = 0; index < report->astStageCount; index++) {
+    fprintf(file, "%s{\"stage\":\"%s\",\"nodes\":%d}", index > 0 ? "," : "", report->astStages[index].name, report->astStages[index].nodes);
+  }
+
+  fprintf(file, "],\"ir\":[");
+  for (int index = 0; index < report->moduleStageCount; index++) {
+    ModuleStage* stage = &report->moduleStages[index];
+    fprintf(file, "%s{\"stage\":\"%s\",\"functions\":%d,\"blocks\":%d,\"instructions\":%d}", index > 0 ? "," : "",
+      stage->name, stage->functions, stage->blocks, stage->instructions);
+  }
+  fprintf(file, "]");
+
+  if (report->object >= 0) {
+    fprintf(file, ",\"object_bytes\":%ld", report->object);
+  }
+  if (report->output >= 0) {
+    fprintf(file, ",\"output_bytes\":%ld", report->output);
+  }
+  fprintf(file, "}\n");
+}
+
+/**
+ * Print report to file at once, the reports of concurrent compilations are never interleaved.
+ * A JSON report takes one line.
+ */
+void PrintReport(Report report, FILE* file) {
+  if (report == NULL) {
+    return;
+  }
+  char* text = NULL;
+  size_t length = 0;
+  FILE* buffer = open_memstream(&text, &length);
+  if (report->format == JsonReport) {
+    PrintJson(report, buffer);
+  } else {
+    PrintText(report, buffer);
+  }
+  fclose(buffer);
+  fwrite(text, 1, length, file);
+  fflush(file);
+  free(text);
+}
@@ -0,0 +1,70 @@
+#ifndef __REPORT_H_
+#define __REPORT_H_
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max count of AST node counts and LLVM IR statistics recorded in a report. */
+#define REPORT_STAGE_LIMIT 16
+
+/**
+ * Format of time report.
+ */
+typedef enum {
+  NoReport = 0,
+  TextReport,
+  JsonReport
+} ReportFormat;
+
+/**
+ * Phases of compilation and execution, measured one by one.
+ */
+typedef enum {
+  ParsePhase = 0,
+  OptimizePhase,
+  EvaluatePhase,
+  GeneratePhase,
+  OptimizeModulePhase,
+  LowerPhase,
+  EmitPhase,
+  LinkPhase,
+  /* compiling with JIT on its compile threads, while executing. */
+  JitPhase,
+  ExecutePhase,
+  PhaseCount
+} Phase;
+
+/**
+ * Time report of a source file: wall time, CPU time and peak RSS of each phase, with AST and LLVM IR statistics.
+ * All functions take NULL report as disabled, and do nothing.
+ */
+typedef struct _Report* Report;
+
+/**
+ * Clocks at the beginning of a phase measured on another thread, see BeginConcurrentPhase.
+ */
+typedef struct _PhaseClocks {
+  double wall;
+  double cpu;
+} PhaseClocks;
+
+Report NewReport(char*, ReportFormat);
+void DisposeReport(Report);
+void BeginPhase(Report, Phase);
+void EndPhase(Report, Phase);
+PhaseClocks BeginConcurrentPhase(Report);
+void EndConcurrentPhase(Report, Phase, PhaseClocks);
+void ReportAstNodes(Report, char*, int);
+void ReportModule(Report, char*, int, int, int);
+void ReportObject(Report, long);
+void ReportOutput(Report, char*);
+void PrintReport(Report, FILE*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
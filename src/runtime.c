@@ -0,0 +1,370 @@
+/**
+ * Brainfuck runtime: buffered standard input and output, guarded tape and profile report.
+ *
+ * It's linked into executable files, and mapped into JIT for scripting.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "runtime.h"
+
+/* Input buffer and the unread range. */
+static unsigned char input[RUNTIME_BUFFER_CAPACITY];
+static int inputBegin = 0;
+static int inputEnd = 0;
+
+/* Output buffer and the length of pending bytes. */
+static unsigned char output[RUNTIME_BUFFER_CAPACITY];
+static int outputLength = 0;
+
+/* Flush output buffer when pending bytes reach the size. */
+static int outputSize = RUNTIME_BUFFER_SIZE;
+
+/* Flush output buffer at end of line. */
+static int lineBuffered = 0;
+
+/* Mapped tape: the beginning of tape and the whole range with guard regions. */
+static unsigned char* tapeBegin = NULL;
+static unsigned char* mappingBegin = NULL;
+static unsigned char* mappingEnd = NULL;
+
+/* Alternative stack for signal handler. */
+static unsigned char signalStack[64 * 1024];
+
+/**
+ * Setup the size of output buffer and line buffered mode.
+ */
+void bf_setup(int size, int line) {
+  outputSize = size > 0 && size <= RUNTIME_BUFFER_CAPACITY ? size : RUNTIME_BUFFER_CAPACITY;
+  lineBuffered = line;
+}
+
+/**
+ * Write all bytes to file descriptor.
+ */
+static void WriteAll(int fd, const unsigned char* bytes, int length) {
+  int offset = 0;
+  while (offset < length) {
+    ssize_t count = write(fd, bytes + offset, length - offset);
+    if (count > 0) {
+      offset += count;
+    } else if (count < 0 && errno == EINTR) {
+      continue;
+    } else {
+      break;
+    }
+  }
+}
+
+/**
+ * Write all pending output bytes to standard output.
+ */
+void bf_flush(void) {
+  WriteAll(STDOUT_FILENO, output, outputLength);
+  outputLength = 0;
+}
+
+/**
+ * Read one byte from standard input, return -1 at end of file.
+ * Pending output is flushed before waiting for input.
+ */
+int bf_read(void) {
+  if (inputBegin == inputEnd) {
+    bf_flush();
+    ssize_t length;
+    do {
+      length = read(STDIN_FILENO, input, RUNTIME_BUFFER_CAPACITY);
+    } while (length < 0 && errno == EINTR);
+    if (length <= 0) {
+      return -1;
+    }
+    inputBegin = 0;
+    inputEnd = length;
+  }
+  return input[inputBegin++];
+}
+
+/**
+ * Write one byte to standard output.
+ */
+void bf_write(int value) {
+  output[outputLength++] = value;
+  if (outputLength >= outputSize || (lineBuffered && value == '\n')) {
+    bf_flush();
+  }
+}
+
+/**
+ * Write constant bytes to standard output.
+ * Bytes larger than the buffer are written directly.
+ */
+void bf_write_bytes(const unsigned char* bytes, int length) {
+  if (outputLength + length > outputSize) {
+    bf_flush();
+  }
+  if (length >= outputSize) {
+    WriteAll(STDOUT_FILENO, bytes, length);
+  } else {
+    memcpy(output + outputLength, bytes, length);
+    outputLength += length;
+    if (outputLength >= outputSize || (lineBuffered && memchr(bytes, '\n', length) != NULL)) {
+      bf_flush();
+    }
+  }
+}
+
+/**
+ * Write the message and the decimal number to standard error, async-signal-safe.
+ */
+static void ReportError(const char* message, long number) {
+  char digits[32];
+  int length = sizeof(digits);
+  unsigned long value = number < 0 ? -(unsigned long)number : (unsigned long)number;
+  do {
+    digits[--length] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  if (number < 0) {
+    digits[--length] = '-';
+  }
+  write(STDERR_FILENO, message, strlen(message));
+  write(STDERR_FILENO, digits + length, sizeof(digits) - length);
+  write(STDERR_FILENO, "\n", 1);
+}
+
+/**
+ * Segmentation fault handler: report access to guard regions as out of bounds error.
+ */
+static void HandleSegmentationFault(int signal, siginfo_t* info, void* context) {
+  unsigned char* address = (unsigned char*)info->si_addr;
+  if (address >= mappingBegin && address < mappingEnd) {
+    bf_flush();
+    ReportError("Error: data pointer out of bounds at cell ", address - tapeBegin);
+    _exit(EXIT_FAILURE);
+  }
+  // not the tape: fault again with default action.
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = SIG_DFL;
+  sigaction(signal, &action, NULL);
+}
+
+/**
+ * Map the tape with given size, surrounded by inaccessible guard regions.
+ * Pages are committed on touch, and access to guard regions is reported as error.
+ * Return the beginning of tape.
+ */
+unsigned char* bf_map_tape(long size) {
+  long page = sysconf(_SC_PAGESIZE);
+  size = (size + page - 1) / page * page;
+  long length = RUNTIME_GUARD_SIZE + size + RUNTIME_GUARD_SIZE;
+  void* mapping = mmap(NULL, length, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (mapping == MAP_FAILED) {
+    ReportError("Error: map tape failed, errno ", errno);
+    _exit(EXIT_FAILURE);
+  }
+  mappingBegin = (unsigned char*)mapping;
+  mappingEnd = mappingBegin + length;
+  tapeBegin = mappingBegin + RUNTIME_GUARD_SIZE;
+  if (mprotect(tapeBegin, size, PROT_READ | PROT_WRITE) != 0) {
+    ReportError("Error: map tape failed, errno ", errno);
+    _exit(EXIT_FAILURE);
+  }
+
+  stack_t stack;
+  memset(&stack, 0, sizeof(stack));
+  stack.ss_sp = signalStack;
+  stack.ss_size = sizeof(signalStack);
+  sigaltstack(&stack, NULL);
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_sigaction = HandleSegmentationFault;
+  action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGSEGV, &action, NULL);
+
+  return tapeBegin;
+}
+
+/* Profile */
+
+/**
+ * Operations executed in all iterations of loop.
+ */
+static int64_t ExecutedOperations(LoopProfile* loop) {
+  return loop->iterations * loop->operations;
+}
+
+/**
+ * Return if the loop executed more operations than the other one.
+ */
+static int Hotter(LoopProfile* loop, LoopProfile* other) {
+  int64_t operations = ExecutedOperations(loop);
+  int64_t others = ExecutedOperations(other);
+  return operations > others || (operations == others && loop->iterations > other->iterations);
+}
+
+static void SwapLoops(LoopProfile* loops, int index, int other) {
+  LoopProfile loop = loops[index];
+  loops[index] = loops[other];
+  loops[other] = loop;
+}
+
+/**
+ * Sift the loop at root down the heap, the coldest loop is on top.
+ */
+static void SiftDown(LoopProfile* loops, int root, int count) {
+  while (root * 2 + 1 < count) {
+    int child = root * 2 + 1;
+    if (child + 1 < count && Hotter(&loops[child], &loops[child + 1])) {
+      child++;
+    }
+    if (!Hotter(&loops[root], &loops[child])) {
+      return;
+    }
+    SwapLoops(loops, root, child);
+    root = child;
+  }
+}
+
+/**
+ * Sort the loops from the hottest with heap sort in place, no memory is allocated.
+ */
+static void SortLoops(LoopProfile* loops, int count) {
+  for (int root = count / 2 - 1; root >= 0; root--) {
+    SiftDown(loops, root, count);
+  }
+  for (int end = count - 1; end > 0; end--) {
+    SwapLoops(loops, 0, end);
+    SiftDown(loops, 0, end);
+  }
+}
+
+/**
+ * Append the text left aligned in width.
+ */
+static char* AppendText(char* cursor, const char* text, int width) {
+  int length = strlen(text);
+  memcpy(cursor, text, length);
+  for (; length < width; length++) {
+    cursor[length] = ' ';
+  }
+  return cursor + length;
+}
+
+/**
+ * Append the decimal number right aligned in width, the last digit is the fraction if scaled by 10.
+ */
+static char* AppendNumber(char* cursor, int64_t number, int scaled, int width) {
+  char digits[32];
+  int length = sizeof(digits);
+  uint64_t value = number < 0 ? 0 : (uint64_t)number;
+  if (scaled) {
+    digits[--length] = '0' + value % 10;
+    digits[--length] = '.';
+    value /= 10;
+  }
+  do {
+    digits[--length] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  while ((int)sizeof(digits) - length < width) {
+    digits[--length] = ' ';
+  }
+  memcpy(cursor, digits + length, sizeof(digits) - length);
+  return cursor + sizeof(digits) - length;
+}
+
+/**
+ * Write the counters of loops in program order to profile file, one line per loop, for profile-guided optimization.
+ */
+static void WriteProfile(LoopProfile* loops, int count, const char* filename) {
+  int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    ReportError("Error: open profile file failed, errno ", errno);
+    return;
+  }
+  char buffer[4096];
+  char* cursor = AppendText(buffer, RUNTIME_PROFILE_HEADER, 0);
+  for (int index = 0; index < count; index++) {
+    cursor = AppendNumber(cursor, loops[index].line, 0, 0);
+    *cursor++ = ' ';
+    cursor = AppendNumber(cursor, loops[index].column, 0, 0);
+    *cursor++ = ' ';
+    cursor = AppendNumber(cursor, loops[index].entries, 0, 0);
+    *cursor++ = ' ';
+    cursor = AppendNumber(cursor, loops[index].iterations, 0, 0);
+    *cursor++ = '\n';
+    // a line takes less than 128 bytes.
+    if (cursor - buffer > (int)sizeof(buffer) - 128) {
+      WriteAll(fd, (unsigned char*)buffer, cursor - buffer);
+      cursor = buffer;
+    }
+  }
+  WriteAll(fd, (unsigned char*)buffer, cursor - buffer);
+  close(fd);
+}
+
+/**
+ * Report the hottest loops to standard error at exit of instrumented program:
+ * entries, iterations, average trip count and share of executed operations of each loop, by source location.
+ * The operations out of loops are given, they run once. The counters are written to profile file first if given.
+ */
+void bf_profile(LoopProfile* loops, int count, int64_t operations, const char* filename) {
+  if (filename != NULL) {
+    WriteProfile(loops, count, filename);
+  }
+  int entered = 0;
+  for (int index = 0; index < count; index++) {
+    entered += loops[index].entries > 0;
+    operations += ExecutedOperations(&loops[index]);
+  }
+  SortLoops(loops, count);
+
+  char line[256];
+  char* cursor = AppendText(line, "\nProfile: ", 0);
+  cursor = AppendNumber(cursor, operations, 0, 0);
+  cursor = AppendText(cursor, " operations executed, ", 0);
+  cursor = AppendNumber(cursor, entered, 0, 0);
+  cursor = AppendText(cursor, " of ", 0);
+  cursor = AppendNumber(cursor, count, 0, 0);
+  cursor = AppendText(cursor, " loops entered.\n", 0);
+  if (entered > 0) {
+    cursor = AppendText(cursor, "\n  location        entries    iterations  average trip   share\n", 0);
+  }
+  WriteAll(STDERR_FILENO, (unsigned char*)line, cursor - line);
+
+  int shown = 0;
+  for (int index = 0; index < count && shown < RUNTIME_PROFILE_LIMIT; index++) {
+    LoopProfile* loop = &loops[index];
+    if (loop->entries == 0) {
+      continue;
+    }
+    char location[64];
+    char* end = AppendNumber(location, loop->line, 0, 0);
+    *end++ = ':';
+    end = AppendNumber(end, loop->column, 0, 0);
+    *end = '\0';
+    cursor = AppendText(line, "  ", 0);
+    cursor = AppendText(cursor, location, 12);
+    cursor = AppendNumber(cursor, loop->entries, 0, 11);
+    cursor = AppendNumber(cursor, loop->iterations, 0, 14);
+    cursor = AppendNumber(cursor, loop->iterations * 10 / loop->entries, 1, 14);
+    cursor = AppendNumber(cursor, operations > 0 ? ExecutedOperations(loop) * 1000 / operations : 0, 1, 7);
+    cursor = AppendText(cursor, "%\n", 0);
+    WriteAll(STDERR_FILENO, (unsigned char*)line, cursor - line);
+    shown++;
+  }
+  if (entered > shown) {
+    cursor = AppendText(line, "  ... ", 0);
+    cursor = AppendNumber(cursor, entered - shown, 0, 0);
+    cursor = AppendText(cursor, " more loops entered.\n", 0);
+    WriteAll(STDERR_FILENO, (unsigned char*)line, cursor - line);
+  }
+}
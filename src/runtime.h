@@ -0,0 +1,50 @@
+#ifndef __RUNTIME_H_
+#define __RUNTIME_H_
+
+#include <stdint.h>
+
+/* Capacity of input and output buffers. */
+#define RUNTIME_BUFFER_CAPACITY (1024 * 1024)
+
+/* Default size of output buffer to flush. */
+#define RUNTIME_BUFFER_SIZE (64 * 1024)
+
+/* Size of inaccessible guard region on each side of the mapped tape. */
+#define RUNTIME_GUARD_SIZE (1L << 30)
+
+/* Count of the hottest loops shown in profile report. */
+#define RUNTIME_PROFILE_LIMIT 20
+
+/* First line of profile file, followed by a line for each loop. */
+#define RUNTIME_PROFILE_HEADER "# brainfuck loop profile: line column entries iterations\n"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Profile of loop: the counters increased by instrumented code, and the source location of `[`.
+ * All fields are 64-bit integers, so the profiles are an array of i64 in LLVM IR.
+ */
+typedef struct _LoopProfile {
+  int64_t entries;
+  int64_t iterations;
+  int64_t line;
+  int64_t column;
+  /* operations of each iteration, the nested loops excluded. */
+  int64_t operations;
+} LoopProfile;
+
+void bf_setup(int, int);
+int bf_read(void);
+void bf_write(int);
+void bf_write_bytes(const unsigned char*, int);
+void bf_flush(void);
+unsigned char* bf_map_tape(long);
+void bf_profile(LoopProfile*, int, int64_t, const char*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ * Scanner of source files: the source is mapped into memory, and scanned in blocks of bytes with SIMD where available.
+ *
+ * Comments are skipped a block at a time, and a run of `+` and `-`, or `<` and `>`, mixed with comments is counted
+ * into one token with the net count, so the parser takes one token per run instead of one per command.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "parser.h"
+#include "scanner.h"
+
+/* Size of buffer to read the source file, which can't be mapped, e.g. a pipe. */
+#define READ_BUFFER_SIZE (64 * 1024)
+
+/* Characters of commands, `#` is not a command unless single line comments are enabled. */
+static const bool commands[256] = {
+  ['+'] = true, ['-'] = true, ['<'] = true, ['>'] = true,
+  [','] = true, ['.'] = true, ['['] = true, [']'] = true,
+};
+
+/* Source */
+
+/**
+ * Read the whole file on heap, for the files can't be mapped.
+ */
+static void ReadSource(Scanner scanner, int fd) {
+  size_t capacity = READ_BUFFER_SIZE;
+  size_t length = 0;
+  char* bytes = (char*)malloc(capacity);
+  ssize_t count;
+  while ((count = read(fd, bytes + length, capacity - length)) > 0) {
+    length += count;
+    if (length == capacity) {
+      capacity *= 2;
+      bytes = (char*)realloc(bytes, capacity);
+    }
+  }
+  if (count < 0) {
+    fprintf(stderr, "Read source file %s failed!\n", scanner->options->source);
+    exit(EXIT_FAILURE);
+  }
+  scanner->begin = bytes;
+  scanner->end = bytes + length;
+}
+
+/**
+ * Constructor for scanner: map the source file into memory.
+ */
+Scanner NewScanner(char* source, Options options) {
+  int fd = open(source, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Open source file %s failed!\n", source);
+    exit(EXIT_FAILURE);
+  }
+
+  Scanner scanner = (Scanner)calloc(sizeof(struct _Scanner), 1);
+  scanner->options = options;
+  struct stat status;
+  if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0) {
+    void* bytes = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (bytes != MAP_FAILED) {
+      madvise(bytes, status.st_size, MADV_SEQUENTIAL);
+      scanner->begin = (char*)bytes;
+      scanner->end = scanner->begin + status.st_size;
+      scanner->mapped = true;
+    }
+  }
+  if (!scanner->mapped) {
+    ReadSource(scanner, fd);
+  }
+  close(fd);
+  scanner->cursor = scanner->begin;
+  scanner->line = 1;
+  scanner->lineBegin = scanner->begin;
+  scanner->counted = scanner->begin;
+  return scanner;
+}
+
+/**
+ * Destructor for scanner: unmap the source file.
+ */
+void DisposeScanner(Scanner scanner) {
+  if (scanner != NULL) {
+    if (scanner->mapped) {
+      munmap(scanner->begin, scanner->end - scanner->begin);
+    } else {
+      free(scanner->begin);
+    }
+    free(scanner);
+  }
+}
+
+/**
+ * Source location of the byte at position, lines are counted on demand from the last located position forward.
+ */
+static Location Locate(Scanner scanner, char* position) {
+  char* newline;
+  while ((newline = memchr(scanner->counted, '\n', position - scanner->counted)) != NULL) {
+    scanner->line++;
+    scanner->lineBegin = newline + 1;
+    scanner->counted = newline + 1;
+  }
+  scanner->counted = position;
+  return (Location){ scanner->line, position - scanner->lineBegin + 1 };
+}
+
+/**
+ * Line number of the last token, for error messages.
+ */
+int ScannerLineNumber(Scanner scanner) {
+  return Locate(scanner, scanner->cursor).line;
+}
+
+/* Classification */
+
+static inline bool IsCommand(Scanner scanner, char c) {
+  return commands[(unsigned char)c] || (c == '#' && scanner->options->singleLineCommentEnabled);
+}
+
+#ifdef __SSE2__
+
+/* Count of bytes classified at once. */
+#define BLOCK_SIZE 16
+
+/**
+ * Mask of bytes in block equal to the character.
+ */
+static inline unsigned int Match(__m128i block, char c) {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+}
+
+/**
+ * Mask of command bytes in block.
+ */
+static inline unsigned int CommandMask(Scanner scanner, __m128i block) {
+  unsigned int mask = Match(block, '+') | Match(block, '-') | Match(block, '<') | Match(block, '>')
+    | Match(block, ',') | Match(block, '.') | Match(block, '[') | Match(block, ']');
+  return scanner->options->singleLineCommentEnabled ? mask | Match(block, '#') : mask;
+}
+
+#endif
+
+/* Scanning */
+
+/**
+ * Return the first command byte at or after cursor, or the end of source.
+ */
+static char* SkipComments(Scanner scanner, char* cursor) {
+#ifdef __SSE2__
+  // commands are often adjacent, check the first byte before a block.
+  if (cursor < scanner->end && IsCommand(scanner, *cursor)) {
+    return cursor;
+  }
+  for (; cursor + BLOCK_SIZE <= scanner->end; cursor += BLOCK_SIZE) {
+    unsigned int mask = CommandMask(scanner, _mm_loadu_si128((__m128i*)cursor));
+    if (mask != 0) {
+      return cursor + __builtin_ctz(mask);
+    }
+  }
+#endif
+  while (cursor < scanner->end && !IsCommand(scanner, *cursor)) {
+    cursor++;
+  }
+  return cursor;
+}
+
+/**
+ * Scan a run of the commands up and down mixed with comments, until any other command.
+ * Return the count of up minus the count of down.
+ */
+static int ScanRun(Scanner scanner, char up, char down) {
+  char* cursor = scanner->cursor;
+  int count = 0;
+#ifdef __SSE2__
+  // runs are often short, count the first bytes one by one before blocks.
+  for (char* limit = cursor + BLOCK_SIZE; cursor < limit && cursor < scanner->end; cursor++) {
+    if (*cursor == up) {
+      count++;
+    } else if (*cursor == down) {
+      count--;
+    } else {
+      break;
+    }
+  }
+  if (cursor == scanner->end || (*cursor != up && *cursor != down && IsCommand(scanner, *cursor))) {
+    scanner->cursor = cursor;
+    return count;
+  }
+  for (; cursor + BLOCK_SIZE <= scanner->end; cursor += BLOCK_SIZE) {
+    __m128i block = _mm_loadu_si128((__m128i*)cursor);
+    unsigned int ups = Match(block, up);
+    unsigned int downs = Match(block, down);
+    unsigned int stops = CommandMask(scanner, block) & ~(ups | downs);
+    if (stops != 0) {
+      unsigned int prefix = (1u << __builtin_ctz(stops)) - 1;
+      scanner->cursor = cursor + __builtin_ctz(stops);
+      return count + __builtin_popcount(ups & prefix) - __builtin_popcount(downs & prefix);
+    }
+    count += __builtin_popcount(ups) - __builtin_popcount(downs);
+  }
+#endif
+  for (; cursor < scanner->end; cursor++) {
+    if (*cursor == up) {
+      count++;
+    } else if (*cursor == down) {
+      count--;
+    } else if (IsCommand(scanner, *cursor)) {
+      break;
+    }
+  }
+  scanner->cursor = cursor;
+  return count;
+}
+
+/**
+ * Return the next token for the parser, runs of updates and moves are returned with their net count.
+ */
+int yylex(YYSTYPE* value, Scanner scanner) {
+  while (true) {
+    char* cursor = SkipComments(scanner, scanner->cursor);
+    if (cursor == scanner->end) {
+      scanner->cursor = cursor;
+      return YYEOF;
+    }
+
+    scanner->cursor = cursor + 1;
+    switch (*cursor) {
+    case '+':
+    case '-':
+      scanner->cursor = cursor;
+      value->parameter = ScanRun(scanner, '+', '-');
+      return UPDATE;
+    case '>':
+    case '<':
+      scanner->cursor = cursor;
+      value->parameter = ScanRun(scanner, '>', '<');
+      return MOVE;
+    case ',':
+      return INPUT;
+    case '.':
+      return OUTPUT;
+    case '[':
+      value->location = Locate(scanner, cursor);
+      return WHILE;
+    case ']':
+      return WEND;
+    default:
+      // single line comment
+      cursor = memchr(cursor, '\n', scanner->end - cursor);
+      scanner->cursor = cursor == NULL ? scanner->end : cursor + 1;
+      break;
+    }
+  }
+}
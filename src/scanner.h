@@ -0,0 +1,29 @@
+#ifndef __SCANNER_H_
+#define __SCANNER_H_
+
+#include <stdbool.h>
+
+#include "options.h"
+
+/**
+ * Scanner of a source file, mapped into memory as a whole.
+ */
+typedef struct _Scanner {
+  Options options;
+  /* Bytes of source file, mapped or read on heap. */
+  char* begin;
+  char* end;
+  bool mapped;
+  /* Next byte to scan. */
+  char* cursor;
+  /* Line number at the counted position, and the beginning of the line. */
+  int line;
+  char* lineBegin;
+  char* counted;
+} *Scanner;
+
+Scanner NewScanner(char*, Options);
+void DisposeScanner(Scanner);
+int ScannerLineNumber(Scanner);
+
+#endif
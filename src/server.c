@@ -0,0 +1,310 @@
+/**
+ * Compile server: a warm process, with LLVM and the embedded runtime set up once, serves command lines of clients
+ * on a Unix domain socket.
+ *
+ * A request is the working directory and command line arguments of client, with its standard input, output and
+ * error passed by SCM_RIGHTS, the reply is the exit status. Each connection is handled by a forked process, which
+ * runs the request in a forked worker process: exits, crashes and runtime state of requests never reach the server.
+ */
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "options.h"
+#include "engine.h"
+#include "linker.h"
+#include "server.h"
+
+/* Count of standard streams passed with request: input, output and error. */
+#define STREAM_COUNT 3
+
+/* Size limit of request in bytes. */
+#define REQUEST_SIZE_LIMIT (1 << 20)
+
+/* Self-pipe written when the worker exits, it's polled with the client connection. */
+static int exited[2] = {-1, -1};
+
+/**
+ * Socket address of file path.
+ */
+static struct sockaddr_un SocketAddress(char* path) {
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(address.sun_path)) {
+    fprintf(stderr, "Socket file name %s is too long!\n", path);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(address.sun_path, path);
+  return address;
+}
+
+static bool ReadFully(int fd, void* buffer, size_t length) {
+  char* bytes = (char*)buffer;
+  while (length > 0) {
+    ssize_t count = read(fd, bytes, length);
+    if (count < 0 && errno == EINTR) {
+      continue;
+    } else if (count <= 0) {
+      return false;
+    }
+    bytes += count;
+    length -= count;
+  }
+  return true;
+}
+
+static bool WriteFully(int fd, void* buffer, size_t length) {
+  char* bytes = (char*)buffer;
+  while (length > 0) {
+    ssize_t count = send(fd, bytes, length, MSG_NOSIGNAL);
+    if (count < 0 && errno == EINTR) {
+      continue;
+    } else if (count <= 0) {
+      return false;
+    }
+    bytes += count;
+    length -= count;
+  }
+  return true;
+}
+
+/* Server */
+
+/**
+ * Listen on socket file, which is accessible by the owner only.
+ * The socket file left by a stopped server is replaced, but not the one of a running server.
+ */
+static int Listen(char* path) {
+  struct sockaddr_un address = SocketAddress(path);
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (connect(listener, (struct sockaddr*)&address, sizeof(address)) == 0) {
+    fprintf(stderr, "Server is running on %s already!\n", path);
+    exit(EXIT_FAILURE);
+  }
+  struct stat status;
+  if (lstat(path, &status) == 0 && S_ISSOCK(status.st_mode)) {
+    unlink(path);
+  }
+  close(listener);
+
+  listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  mode_t mask = umask(0077);
+  int bound = bind(listener, (struct sockaddr*)&address, sizeof(address));
+  umask(mask);
+  if (listener < 0 || bound != 0 || listen(listener, SOMAXCONN) != 0) {
+    fprintf(stderr, "Listen on %s failed: %s\n", path, strerror(errno));
+    exit(EXIT_FAILURE);
+  }
+  return listener;
+}
+
+/**
+ * Receive the length of request with standard streams of client.
+ */
+static bool ReceiveHeader(int client, unsigned int* length, int* streams) {
+  char control[CMSG_SPACE(sizeof(int) * STREAM_COUNT)];
+  struct iovec vector = {length, sizeof(unsigned int)};
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &vector;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+  if (recvmsg(client, &message, 0) != sizeof(unsigned int)) {
+    return false;
+  }
+
+  struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+  if (header == NULL || header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS
+      || header->cmsg_len != CMSG_LEN(sizeof(int) * STREAM_COUNT)) {
+    return false;
+  }
+  memcpy(streams, CMSG_DATA(header), sizeof(int) * STREAM_COUNT);
+  return *length > 0 && *length <= REQUEST_SIZE_LIMIT;
+}
+
+static void NotifyExited(int signal) {
+  int error = errno;
+  write(exited[1], "", 1);
+  errno = error;
+}
+
+/**
+ * Wait for the worker, it's killed if the client is gone before it exits.
+ * Return the exit status of worker, or 128 plus the signal number like shell.
+ */
+static int WaitWorker(int client, pid_t worker) {
+  struct pollfd events[2] = {{exited[0], POLLIN, 0}, {client, POLLIN, 0}};
+  int status = 0;
+  while (waitpid(worker, &status, WNOHANG) == 0) {
+    if (poll(events, 2, -1) > 0 && events[1].revents != 0) {
+      // the client sends nothing more, any event is the hang up.
+      kill(worker, SIGKILL);
+      events[1].fd = -1;
+    } else if (events[0].revents != 0) {
+      char byte;
+      read(exited[0], &byte, 1);
+    }
+  }
+  return WIFEXITED(status) ? WEXITSTATUS(status) : WIFSIGNALED(status) ? 128 + WTERMSIG(status) : EXIT_FAILURE;
+}
+
+/**
+ * Handle the request of client in the forked process, and reply with the exit status.
+ * It returns in the worker process only, with the standard streams, working directory and options of request.
+ */
+static void Handle(int client) {
+  unsigned int length = 0;
+  int streams[STREAM_COUNT];
+  if (!ReceiveHeader(client, &length, streams)) {
+    _exit(EXIT_FAILURE);
+  }
+  char* request = (char*)malloc(length);
+  if (!ReadFully(client, request, length) || request[length - 1] != '\0') {
+    _exit(EXIT_FAILURE);
+  }
+
+  // The working directory, followed by arguments.
+  int argc = 0;
+  char** argv = (char**)calloc(length + 1, sizeof(char*));
+  for (char* argument = request + strlen(request) + 1; argument < request + length; argument += strlen(argument) + 1) {
+    argv[argc++] = argument;
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = NotifyExited;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+  if (pipe(exited) != 0 || sigaction(SIGCHLD, &action, NULL) != 0) {
+    _exit(EXIT_FAILURE);
+  }
+
+  pid_t worker = fork();
+  if (worker == 0) {
+    signal(SIGCHLD, SIG_DFL);
+    close(client);
+    close(exited[0]);
+    close(exited[1]);
+    for (int fd = 0; fd < STREAM_COUNT; fd++) {
+      dup2(streams[fd], fd);
+    }
+    for (int fd = 0; fd < STREAM_COUNT; fd++) {
+      if (streams[fd] >= STREAM_COUNT) {
+        close(streams[fd]);
+      }
+    }
+    if (chdir(request) != 0) {
+      fprintf(stderr, "Change directory to %s failed: %s\n", request, strerror(errno));
+      exit(EXIT_FAILURE);
+    }
+    ParseCommandLineArguments(argc, argv);
+    return;
+  }
+
+  for (int fd = 0; fd < STREAM_COUNT; fd++) {
+    close(streams[fd]);
+  }
+  int status = worker > 0 ? WaitWorker(client, worker) : EXIT_FAILURE;
+  WriteFully(client, &status, sizeof(status));
+  _exit(EXIT_SUCCESS);
+}
+
+/**
+ * Listen on socket file, and serve requests of clients until the server is killed.
+ * LLVM, the target machines and the embedded runtime are set up once before serving, the forked processes inherit them.
+ * It returns in the worker process of each request only.
+ */
+void Serve(char* path) {
+  int listener = Listen(path);
+  PrepareEngines();
+  SetUpLinker();
+  // the handler processes are reaped by system.
+  signal(SIGCHLD, SIG_IGN);
+
+  while (true) {
+    int client = accept(listener, NULL, NULL);
+    if (client < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      fprintf(stderr, "Accept on %s failed: %s\n", path, strerror(errno));
+      exit(EXIT_FAILURE);
+    }
+
+    pid_t handler = fork();
+    if (handler == 0) {
+      close(listener);
+      Handle(client);
+      return;
+    }
+    close(client);
+  }
+}
+
+/* Client */
+
+/**
+ * Send the working directory, command line arguments and standard streams to server,
+ * and return the exit status replied.
+ */
+int Request(char* path, int argc, char* argv[]) {
+  struct sockaddr_un address = SocketAddress(path);
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (connect(server, (struct sockaddr*)&address, sizeof(address)) != 0) {
+    fprintf(stderr, "Connect to server %s failed: %s\n", path, strerror(errno));
+    exit(EXIT_FAILURE);
+  }
+
+  char* directory = getcwd(NULL, 0);
+  unsigned int length = strlen(directory) + 1;
+  for (int index = 0; index < argc; index++) {
+    length += strlen(argv[index]) + 1;
+  }
+  if (length > REQUEST_SIZE_LIMIT) {
+    fprintf(stderr, "Command line arguments are too long!\n");
+    exit(EXIT_FAILURE);
+  }
+  char* request = (char*)malloc(length);
+  char* end = stpcpy(request, directory) + 1;
+  for (int index = 0; index < argc; index++) {
+    end = stpcpy(end, argv[index]) + 1;
+  }
+  free(directory);
+
+  int streams[STREAM_COUNT] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  char control[CMSG_SPACE(sizeof(streams))];
+  memset(control, 0, sizeof(control));
+  struct iovec vector = {&length, sizeof(length)};
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &vector;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+  struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+  header->cmsg_level = SOL_SOCKET;
+  header->cmsg_type = SCM_RIGHTS;
+  header->cmsg_len = CMSG_LEN(sizeof(streams));
+  memcpy(CMSG_DATA(header), streams, sizeof(streams));
+
+  int status = EXIT_FAILURE;
+  if (sendmsg(server, &message, MSG_NOSIGNAL) != sizeof(length) || !WriteFully(server, request, length)
+      || !ReadFully(server, &status, sizeof(status))) {
+    fprintf(stderr, "Request to server %s failed!\n", path);
+    exit(EXIT_FAILURE);
+  }
+  free(request);
+  close(server);
+  return status;
+}
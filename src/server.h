@@ -0,0 +1,7 @@
+#ifndef __SERVER_H_
+#define __SERVER_H_
+
+void Serve(char*);
+int Request(char*, int, char**);
+
+#endif
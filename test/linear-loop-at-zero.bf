@@ -0,0 +1,5 @@
+Linear loop on a zero cell at the left end of tape: the loop body never runs
+so its target cell left of the tape is never touched
+Prints ok with empty input
+,[-<+>]
+++++++++++[>+++++++++++<-]>+.----.[-]++++++++++.
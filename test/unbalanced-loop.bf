@@ -0,0 +1,4 @@
+Unbalanced loop: the loop opened on the last line is never closed
+so the source is invalid and is rejected with a failing exit status
+without running or writing any output
+++++++++++[>+++++++++++<-]>+.----.[